@@ -0,0 +1,118 @@
+#include "bounded_queue.hpp"
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(BoundedQueueTest, PopFromEmptyQueue)
+{
+    BoundedQueue<int, 4> l_queue;
+    int l_value = -1;
+
+    EXPECT_FALSE(l_queue.tryPop(l_value));
+    EXPECT_EQ(l_value, -1);
+}
+
+TEST(BoundedQueueTest, PushToFullQueue)
+{
+    BoundedQueue<int, 4> l_queue;
+
+    for (int l_index = 0; l_index < 4; ++l_index)
+    {
+        EXPECT_TRUE(l_queue.tryPush(int{l_index}));
+    }
+    EXPECT_FALSE(l_queue.tryPush(4));
+
+    // A pop makes room for one more.
+    int l_value = -1;
+    EXPECT_TRUE(l_queue.tryPop(l_value));
+    EXPECT_EQ(l_value, 0);
+    EXPECT_TRUE(l_queue.tryPush(4));
+    EXPECT_FALSE(l_queue.tryPush(5));
+}
+
+TEST(BoundedQueueTest, PopInPushOrder)
+{
+    BoundedQueue<std::string, 8> l_queue;
+
+    // Go around the ring a few times.
+    for (int l_round = 0; l_round < 3; ++l_round)
+    {
+        for (int l_index = 0; l_index < 6; ++l_index)
+        {
+            EXPECT_TRUE(l_queue.tryPush(std::to_string(l_index)));
+        }
+
+        std::string l_value;
+        for (int l_index = 0; l_index < 6; ++l_index)
+        {
+            EXPECT_TRUE(l_queue.tryPop(l_value));
+            EXPECT_EQ(l_value, std::to_string(l_index));
+        }
+        EXPECT_FALSE(l_queue.tryPop(l_value));
+    }
+}
+
+TEST(BoundedQueueTest, MultipleProducers)
+{
+    constexpr size_t l_producerCount = 4;
+    constexpr size_t l_valuesPerProducer = 10000;
+    constexpr size_t l_totalCount = l_producerCount * l_valuesPerProducer;
+
+    BoundedQueue<size_t, 64> l_queue;
+
+    std::vector<std::thread> l_producers;
+    for (size_t l_producer = 0; l_producer < l_producerCount; ++l_producer)
+    {
+        l_producers.emplace_back([&l_queue, l_producer]() {
+            for (size_t l_index = 0; l_index < l_valuesPerProducer; ++l_index)
+            {
+                // Retry till the consumer makes room.
+                while (!l_queue.tryPush(l_producer * l_valuesPerProducer +
+                                        l_index))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Every value is to be popped exactly once, and in order for a producer.
+    std::vector<size_t> l_popCount(l_totalCount, 0);
+    std::vector<size_t> l_nextIndex(l_producerCount, 0);
+    bool l_isInOrder = true;
+
+    size_t l_value = 0;
+    for (size_t l_popped = 0; l_popped < l_totalCount;)
+    {
+        if (!l_queue.tryPop(l_value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ++l_popped;
+        ++l_popCount[l_value];
+
+        const size_t l_producer = l_value / l_valuesPerProducer;
+        l_isInOrder &=
+            (l_value % l_valuesPerProducer == l_nextIndex[l_producer]++);
+    }
+
+    for (auto& l_thread : l_producers)
+    {
+        l_thread.join();
+    }
+
+    EXPECT_FALSE(l_queue.tryPop(l_value));
+    EXPECT_TRUE(l_isInOrder);
+    for (const size_t l_count : l_popCount)
+    {
+        EXPECT_EQ(l_count, 1);
+    }
+}
@@ -0,0 +1,153 @@
+#include "types.hpp"
+#include "utility/common_utility.hpp"
+
+#include <stdlib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+/**
+ * @brief Fixture providing a scratch directory for the command output.
+ */
+class ExecuteSystemCmdTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::string l_template =
+            (std::filesystem::temp_directory_path() / "vpd_cmd_XXXXXX")
+                .string();
+        ASSERT_NE(mkdtemp(l_template.data()), nullptr);
+        m_directory = l_template;
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    std::string getPath(const std::string& i_fileName) const
+    {
+        return (m_directory / i_fileName).string();
+    }
+
+    static std::string readFile(const std::string& i_path)
+    {
+        std::ifstream l_file(i_path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(l_file),
+                           std::istreambuf_iterator<char>());
+    }
+
+    std::filesystem::path m_directory;
+};
+
+TEST_F(ExecuteSystemCmdTest, EchoToAttributeIsWrittenDirectly)
+{
+    const std::string l_attribute = getPath("new_device");
+    std::ofstream(l_attribute).close();
+
+    commonUtility::executeSystemCmd("echo 24c32 0x50 > " + l_attribute);
+    EXPECT_EQ(readFile(l_attribute), "24c32 0x50\n");
+}
+
+TEST_F(ExecuteSystemCmdTest, EchoToMissingAttributeFails)
+{
+    // A shell would create the file, a sysfs attribute is never created.
+    const std::string l_attribute = getPath("new_device");
+
+    EXPECT_THROW(
+        commonUtility::executeSystemCmd("echo 24c32 0x50 > " + l_attribute),
+        std::runtime_error);
+    EXPECT_FALSE(std::filesystem::exists(l_attribute));
+}
+
+TEST_F(ExecuteSystemCmdTest, EchoWithExtraSpaces)
+{
+    const std::string l_attribute = getPath("bind");
+    std::ofstream(l_attribute).close();
+
+    commonUtility::executeSystemCmd("echo   8-0050  >   " + l_attribute);
+    EXPECT_EQ(readFile(l_attribute), "8-0050\n");
+}
+
+TEST_F(ExecuteSystemCmdTest, EchoWithOptionFallsBackToShell)
+{
+    const std::string l_file = getPath("value");
+
+    commonUtility::executeSystemCmd("echo -n 1 > " + l_file);
+    EXPECT_EQ(readFile(l_file), "1");
+}
+
+TEST_F(ExecuteSystemCmdTest, QuotesFallBackToShell)
+{
+    const std::string l_file = getPath("value");
+
+    commonUtility::executeSystemCmd("echo \"a  b\" > " + l_file);
+    EXPECT_EQ(readFile(l_file), "a  b\n");
+}
+
+TEST_F(ExecuteSystemCmdTest, PipeFallsBackToShell)
+{
+    const std::string l_file = getPath("value");
+
+    commonUtility::executeSystemCmd("echo abc | tr a-z A-Z > " + l_file);
+    EXPECT_EQ(readFile(l_file), "ABC\n");
+}
+
+TEST_F(ExecuteSystemCmdTest, CommandIsSpawnedDirectly)
+{
+    const std::string l_file = getPath("value");
+
+    commonUtility::executeSystemCmd("touch " + l_file);
+    EXPECT_TRUE(std::filesystem::exists(l_file));
+}
+
+TEST_F(ExecuteSystemCmdTest, FailedCommand)
+{
+    EXPECT_THROW(commonUtility::executeSystemCmd("false"), std::runtime_error);
+    EXPECT_THROW(commonUtility::executeSystemCmd("echo 1 | false"),
+                 std::runtime_error);
+}
+
+TEST(RunProcessTest, OutputIsSplitInLines)
+{
+    const std::vector<std::string> l_output =
+        commonUtility::runProcess({"printf", "first\nsecond"});
+
+    const std::vector<std::string> l_expected{"first\n", "second"};
+    EXPECT_EQ(l_output, l_expected);
+}
+
+TEST(RunProcessTest, ArgumentsAreNotInterpreted)
+{
+    const std::vector<std::string> l_output =
+        commonUtility::runProcess({"echo", "a  b", "$HOME", "|"});
+
+    const std::vector<std::string> l_expected{"a  b $HOME |\n"};
+    EXPECT_EQ(l_output, l_expected);
+}
+
+TEST(RunProcessTest, NoProgram)
+{
+    EXPECT_THROW(commonUtility::runProcess({}), std::runtime_error);
+}
+
+TEST(RunProcessTest, NonZeroExitStatus)
+{
+    EXPECT_THROW(commonUtility::runProcess({"sh", "-c", "exit 3"}),
+                 std::runtime_error);
+}
+
+TEST(RunProcessTest, MissingProgram)
+{
+    EXPECT_THROW(commonUtility::runProcess({"/nonexistent/program"}),
+                 std::runtime_error);
+}
@@ -0,0 +1,109 @@
+#include "debouncer.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+static constexpr std::chrono::milliseconds quietPeriod(50);
+
+/**
+ * @brief Fixture running a debouncer on a local io context.
+ */
+class DebouncerTest : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief API to trigger the debouncer after a delay.
+     *
+     * @param[in] i_delay - Delay from now.
+     * @param[in] i_value - Value the action records.
+     */
+    void triggerAfter(const std::chrono::milliseconds i_delay, int i_value)
+    {
+        auto l_timer =
+            std::make_shared<boost::asio::steady_timer>(m_ioContext, i_delay);
+
+        l_timer->async_wait([this, l_timer, i_value](
+                                const boost::system::error_code& l_ec) {
+            if (!l_ec)
+            {
+                m_debouncer.trigger(
+                    [this, i_value]() { m_actionValues.push_back(i_value); });
+            }
+        });
+    }
+
+    boost::asio::io_context m_ioContext;
+    Debouncer m_debouncer{m_ioContext, quietPeriod};
+    std::vector<int> m_actionValues;
+};
+
+TEST_F(DebouncerTest, SingleTrigger)
+{
+    triggerAfter(std::chrono::milliseconds(0), 1);
+    m_ioContext.run();
+
+    const std::vector<int> l_expected{1};
+    EXPECT_EQ(m_actionValues, l_expected);
+}
+
+TEST_F(DebouncerTest, BurstRunsLatestActionOnce)
+{
+    // Bounces within the quiet period of each other.
+    for (int l_value = 1; l_value <= 5; ++l_value)
+    {
+        triggerAfter(std::chrono::milliseconds(10 * l_value), l_value);
+    }
+
+    const auto l_start = std::chrono::steady_clock::now();
+    m_ioContext.run();
+    const auto l_elapsed = std::chrono::steady_clock::now() - l_start;
+
+    const std::vector<int> l_expected{5};
+    EXPECT_EQ(m_actionValues, l_expected);
+
+    // Action waits for the quiet period after the last trigger.
+    EXPECT_GE(l_elapsed, std::chrono::milliseconds(50) + quietPeriod);
+}
+
+TEST_F(DebouncerTest, SettledTriggersRunSeparately)
+{
+    triggerAfter(std::chrono::milliseconds(0), 1);
+    triggerAfter(quietPeriod * 3, 2);
+    m_ioContext.run();
+
+    const std::vector<int> l_expected{1, 2};
+    EXPECT_EQ(m_actionValues, l_expected);
+}
+
+TEST_F(DebouncerTest, ActionCanTriggerAgain)
+{
+    m_debouncer.trigger([this]() {
+        m_actionValues.push_back(1);
+        m_debouncer.trigger([this]() { m_actionValues.push_back(2); });
+    });
+    m_ioContext.run();
+
+    const std::vector<int> l_expected{1, 2};
+    EXPECT_EQ(m_actionValues, l_expected);
+}
+
+TEST(DebouncerDestroyTest, PendingActionIsDropped)
+{
+    boost::asio::io_context l_ioContext;
+    bool l_isActionRun = false;
+    {
+        Debouncer l_debouncer(l_ioContext, quietPeriod);
+        l_debouncer.trigger([&l_isActionRun]() { l_isActionRun = true; });
+    }
+    l_ioContext.run();
+
+    EXPECT_FALSE(l_isActionRun);
+}
@@ -0,0 +1,56 @@
+#include "eeprom_watcher.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+static const std::string eepromPath("/tmp/utest_eeprom_watcher_eeprom");
+
+TEST(EepromWatcherTest, ExistingEeprom)
+{
+    std::ofstream(eepromPath).put('\0');
+
+    EepromWatcher l_watcher;
+    EXPECT_TRUE(l_watcher.waitForEeprom(eepromPath, std::chrono::seconds(5)));
+
+    std::filesystem::remove(eepromPath);
+}
+
+TEST(EepromWatcherTest, MissingEepromTimesOut)
+{
+    std::filesystem::remove(eepromPath);
+
+    EepromWatcher l_watcher;
+    const auto l_start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(l_watcher.waitForEeprom(eepromPath,
+                                         std::chrono::milliseconds(100)));
+
+    // Never waits past the timeout.
+    EXPECT_LT(std::chrono::steady_clock::now() - l_start,
+              std::chrono::seconds(5));
+}
+
+TEST(EepromWatcherTest, DestroyWhileListening)
+{
+    std::filesystem::remove(eepromPath);
+
+    // Listener is started by the wait, destruction has to stop it.
+    const auto l_start = std::chrono::steady_clock::now();
+    {
+        EepromWatcher l_watcher;
+        l_watcher.waitForEeprom(eepromPath, std::chrono::milliseconds(10));
+    }
+
+    EXPECT_LT(std::chrono::steady_clock::now() - l_start,
+              std::chrono::seconds(5));
+}
+
+TEST(EepromWatcherTest, DestroyUnused)
+{
+    EXPECT_NO_THROW({ EepromWatcher l_watcher; });
+}
@@ -0,0 +1,228 @@
+#include "eeprom_write_queue.hpp"
+#include "types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+static const std::string eepromPath("/sys/bus/i2c/drivers/at24/8-0050/eeprom");
+
+static types::WriteVpdParams getParams(const std::string& i_keyword,
+                                       uint8_t i_value)
+{
+    return types::IpzData{"VINI", i_keyword, types::BinaryVector{i_value}};
+}
+
+/**
+ * @brief Batch writer returning length of each value as bytes written.
+ */
+static std::vector<types::WriteResult> writeAll(
+    const std::vector<types::WriteVpdParams>& i_params)
+{
+    std::vector<types::WriteResult> l_results;
+    for (const auto& l_params : i_params)
+    {
+        l_results.emplace_back(static_cast<int>(
+            std::get<2>(std::get<types::IpzData>(l_params)).size()));
+    }
+    return l_results;
+}
+
+/**
+ * @brief Fixture writing through a queue of its own.
+ */
+class EepromWriteQueueTest : public ::testing::Test
+{
+  protected:
+    EepromWriteQueue m_eepromWriteQueue;
+};
+
+TEST_F(EepromWriteQueueTest, SingleWrite)
+{
+    size_t l_batchCount = 0;
+    const int l_bytesWritten = m_eepromWriteQueue.write(
+        eepromPath, 0, getParams("DR", 1),
+        [&l_batchCount](const std::vector<types::WriteVpdParams>& i_params) {
+            ++l_batchCount;
+            return writeAll(i_params);
+        });
+
+    EXPECT_EQ(l_bytesWritten, 1);
+    EXPECT_EQ(l_batchCount, 1);
+}
+
+TEST_F(EepromWriteQueueTest, BatchKeepsOrderAndResults)
+{
+    std::vector<types::WriteVpdParams> l_written;
+    const std::vector<types::WriteVpdParams> l_params{
+        getParams("DR", 1), getParams("SN", 2), getParams("CC", 3)};
+
+    const std::vector<types::WriteResult> l_results =
+        m_eepromWriteQueue.writeBatch(
+            eepromPath, 0, l_params,
+            [&l_written](const std::vector<types::WriteVpdParams>& i_params) {
+                l_written = i_params;
+
+                // Fail the second keyword only.
+                std::vector<types::WriteResult> l_results = writeAll(i_params);
+                l_results[1] = std::unexpected(std::make_exception_ptr(
+                    std::runtime_error("Write failed")));
+                return l_results;
+            });
+
+    EXPECT_EQ(l_written, l_params);
+    ASSERT_EQ(l_results.size(), 3);
+    EXPECT_TRUE(l_results[0].has_value());
+    EXPECT_FALSE(l_results[1].has_value());
+    EXPECT_TRUE(l_results[2].has_value());
+}
+
+TEST_F(EepromWriteQueueTest, FailedKeywordThrows)
+{
+    EXPECT_THROW(m_eepromWriteQueue.write(
+                     eepromPath, 0, getParams("DR", 1),
+                     [](const std::vector<types::WriteVpdParams>&)
+                         -> std::vector<types::WriteResult> {
+                         throw std::runtime_error("EEPROM not accessible");
+                     }),
+                 std::runtime_error);
+}
+
+TEST_F(EepromWriteQueueTest, ResultCountMismatchFailsBatch)
+{
+    const std::vector<types::WriteResult> l_results =
+        m_eepromWriteQueue.writeBatch(
+            eepromPath, 0, {getParams("DR", 1), getParams("SN", 2)},
+            [](const std::vector<types::WriteVpdParams>&) {
+                return std::vector<types::WriteResult>{1};
+            });
+
+    ASSERT_EQ(l_results.size(), 2);
+    EXPECT_FALSE(l_results[0].has_value());
+    EXPECT_FALSE(l_results[1].has_value());
+}
+
+TEST_F(EepromWriteQueueTest, WritesDuringBatchAreCoalesced)
+{
+    constexpr size_t l_waitingWriterCount = 4;
+
+    std::mutex l_mutex;
+    std::condition_variable l_condition;
+    bool l_isFirstBatchStarted = false;
+    bool l_isFirstBatchReleased = false;
+    std::vector<size_t> l_batchSizes;
+
+    const EepromWriteQueue::BatchWriter l_batchWriter =
+        [&](const std::vector<types::WriteVpdParams>& i_params) {
+            std::unique_lock<std::mutex> l_lock(l_mutex);
+            l_batchSizes.push_back(i_params.size());
+
+            if (!l_isFirstBatchStarted)
+            {
+                // Hold the first batch till the other writers are queued.
+                l_isFirstBatchStarted = true;
+                l_condition.notify_all();
+                l_condition.wait(l_lock,
+                                 [&]() { return l_isFirstBatchReleased; });
+            }
+            return writeAll(i_params);
+        };
+
+    std::thread l_firstWriter([&]() {
+        EXPECT_EQ(m_eepromWriteQueue.write(eepromPath, 0, getParams("DR", 1),
+                                          l_batchWriter),
+                  1);
+    });
+
+    {
+        std::unique_lock<std::mutex> l_lock(l_mutex);
+        l_condition.wait(l_lock, [&]() { return l_isFirstBatchStarted; });
+    }
+
+    std::atomic<size_t> l_startedCount{0};
+    std::atomic<size_t> l_doneCount{0};
+    std::vector<std::thread> l_writers;
+    for (size_t l_index = 0; l_index < l_waitingWriterCount; ++l_index)
+    {
+        l_writers.emplace_back([&]() {
+            ++l_startedCount;
+            EXPECT_EQ(m_eepromWriteQueue.write(eepromPath, 0,
+                                              getParams("SN", 2),
+                                              l_batchWriter),
+                      1);
+            ++l_doneCount;
+        });
+    }
+
+    // Writers queue up behind the active one, none of them can finish yet.
+    while (l_startedCount != l_waitingWriterCount)
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(l_doneCount, 0);
+
+    {
+        std::lock_guard<std::mutex> l_lock(l_mutex);
+        l_isFirstBatchReleased = true;
+    }
+    l_condition.notify_all();
+
+    l_firstWriter.join();
+    for (auto& l_writer : l_writers)
+    {
+        l_writer.join();
+    }
+
+    const std::vector<size_t> l_expected{1, l_waitingWriterCount};
+    EXPECT_EQ(l_batchSizes, l_expected);
+}
+
+TEST_F(EepromWriteQueueTest, QueuesArePerVpd)
+{
+    size_t l_batchCount = 0;
+    const EepromWriteQueue::BatchWriter l_batchWriter =
+        [&l_batchCount](const std::vector<types::WriteVpdParams>& i_params) {
+            ++l_batchCount;
+            return writeAll(i_params);
+        };
+
+    m_eepromWriteQueue.write(eepromPath, 0, getParams("DR", 1), l_batchWriter);
+    m_eepromWriteQueue.write(eepromPath, 512, getParams("DR", 1),
+                            l_batchWriter);
+
+    EXPECT_EQ(l_batchCount, 2);
+}
+
+TEST_F(EepromWriteQueueTest, ListenerIsToldOfSuccessfulWrites)
+{
+    std::vector<std::string> l_notifiedKeywords;
+    m_eepromWriteQueue.setWriteListener(
+        [&l_notifiedKeywords](const std::string& i_eepromPath,
+                              const types::WriteVpdParams& i_params) {
+            EXPECT_EQ(i_eepromPath, eepromPath);
+            l_notifiedKeywords.push_back(
+                std::get<1>(std::get<types::IpzData>(i_params)));
+        });
+
+    m_eepromWriteQueue.writeBatch(
+        eepromPath, 0, {getParams("DR", 1), getParams("SN", 2)},
+        [](const std::vector<types::WriteVpdParams>& i_params) {
+            std::vector<types::WriteResult> l_results = writeAll(i_params);
+            l_results[0] = std::unexpected(
+                std::make_exception_ptr(std::runtime_error("Write failed")));
+            return l_results;
+        });
+
+    const std::vector<std::string> l_expected{"SN"};
+    EXPECT_EQ(l_notifiedKeywords, l_expected);
+}
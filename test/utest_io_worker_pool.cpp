@@ -0,0 +1,127 @@
+#include "io_worker_pool.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+static const std::string eepromPath("/sys/bus/i2c/drivers/at24/8-0050/eeprom");
+
+TEST(IoWorkerPoolTest, SamePathGetsSameStrand)
+{
+    IoWorkerPool l_pool(2, 4);
+
+    EXPECT_EQ(l_pool.getStrand(eepromPath), l_pool.getStrand(eepromPath));
+    EXPECT_EQ(&l_pool.getStrand(eepromPath), &l_pool.getStrand(eepromPath));
+}
+
+TEST(IoWorkerPoolTest, PathsShareFixedStrands)
+{
+    constexpr size_t l_strandCount = 4;
+    IoWorkerPool l_pool(2, l_strandCount);
+
+    std::vector<const IoWorkerPool::Strand*> l_strands;
+    for (size_t l_index = 0; l_index < 64; ++l_index)
+    {
+        const IoWorkerPool::Strand* l_strand =
+            &l_pool.getStrand(eepromPath + std::to_string(l_index));
+        if (std::find(l_strands.begin(), l_strands.end(), l_strand) ==
+            l_strands.end())
+        {
+            l_strands.push_back(l_strand);
+        }
+    }
+
+    EXPECT_LE(l_strands.size(), l_strandCount);
+    EXPECT_GT(l_strands.size(), 1);
+}
+
+TEST(IoWorkerPoolTest, NoStrandCountGetsOneStrand)
+{
+    IoWorkerPool l_pool(1, 0);
+
+    EXPECT_EQ(&l_pool.getStrand(eepromPath), &l_pool.getStrand("other"));
+}
+
+TEST(IoWorkerPoolTest, TasksOnStrandRunInOrder)
+{
+    constexpr size_t l_taskCount = 100;
+    IoWorkerPool l_pool(4, 2);
+
+    std::atomic<bool> l_isTaskRunning{false};
+    std::atomic<bool> l_isOverlapped{false};
+    std::vector<size_t> l_order;
+    std::promise<void> l_done;
+
+    for (size_t l_index = 0; l_index < l_taskCount; ++l_index)
+    {
+        boost::asio::post(l_pool.getStrand(eepromPath), [&, l_index]() {
+            if (l_isTaskRunning.exchange(true))
+            {
+                l_isOverlapped = true;
+            }
+
+            // Hold the strand so that an overlapping task would be seen.
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            l_order.push_back(l_index);
+
+            l_isTaskRunning = false;
+            if (l_index == l_taskCount - 1)
+            {
+                l_done.set_value();
+            }
+        });
+    }
+    l_done.get_future().wait();
+
+    EXPECT_FALSE(l_isOverlapped);
+    ASSERT_EQ(l_order.size(), l_taskCount);
+    for (size_t l_index = 0; l_index < l_taskCount; ++l_index)
+    {
+        EXPECT_EQ(l_order[l_index], l_index);
+    }
+}
+
+TEST(IoWorkerPoolTest, UnorderedTasksRunConcurrently)
+{
+    constexpr size_t l_threadCount = 2;
+    IoWorkerPool l_pool(l_threadCount, 1);
+
+    // Each task waits for the other, which only works if both run at once.
+    std::atomic<size_t> l_startedCount{0};
+    std::vector<std::future<bool>> l_results;
+    for (size_t l_index = 0; l_index < l_threadCount; ++l_index)
+    {
+        auto l_task = std::make_shared<std::packaged_task<bool()>>([&]() {
+            ++l_startedCount;
+            const auto l_deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (l_startedCount != l_threadCount)
+            {
+                if (std::chrono::steady_clock::now() > l_deadline)
+                {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            return true;
+        });
+        l_results.push_back(l_task->get_future());
+        boost::asio::post(l_pool.getExecutor(), [l_task]() { (*l_task)(); });
+    }
+
+    for (auto& l_result : l_results)
+    {
+        EXPECT_TRUE(l_result.get());
+    }
+}
@@ -0,0 +1,169 @@
+#include "constants.hpp"
+#include "logger.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+/**
+ * @brief A message captured from the logger.
+ */
+struct CapturedMessage
+{
+    logging::LogLevel m_level;
+    std::string m_message;
+};
+
+static std::mutex s_capturedMutex;
+static std::condition_variable s_capturedCondition;
+static std::vector<CapturedMessage> s_capturedMessages;
+
+static void captureMessage(logging::LogLevel i_level,
+                           std::string_view i_message, const char*, uint32_t,
+                           const char*)
+{
+    {
+        std::lock_guard<std::mutex> l_lock(s_capturedMutex);
+        s_capturedMessages.push_back({i_level, std::string(i_message)});
+    }
+    s_capturedCondition.notify_all();
+}
+
+/**
+ * @brief Fixture capturing the messages written by the logger.
+ */
+class LoggerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        logging::setLogSink(captureMessage);
+    }
+
+    void TearDown() override
+    {
+        logging::setLogSink(nullptr);
+
+        std::lock_guard<std::mutex> l_lock(s_capturedMutex);
+        s_capturedMessages.clear();
+    }
+
+    /**
+     * @brief Wait till the given number of messages are captured.
+     *
+     * @param[in] i_count - Number of messages to wait for.
+     *
+     * @return Captured messages.
+     */
+    static std::vector<CapturedMessage> waitForMessages(size_t i_count)
+    {
+        std::unique_lock<std::mutex> l_lock(s_capturedMutex);
+        s_capturedCondition.wait_for(l_lock, std::chrono::seconds(5), [&]() {
+            return s_capturedMessages.size() >= i_count;
+        });
+        return s_capturedMessages;
+    }
+};
+
+TEST_F(LoggerTest, MessageIsDrained)
+{
+    logging::logMessage("first");
+    logging::logMessage<logging::LogLevel::Error>("second");
+
+    const std::vector<CapturedMessage> l_messages = waitForMessages(2);
+    ASSERT_EQ(l_messages.size(), 2);
+    EXPECT_EQ(l_messages[0].m_message, "first");
+    EXPECT_EQ(l_messages[0].m_level, logging::LogLevel::Info);
+    EXPECT_EQ(l_messages[1].m_message, "second");
+    EXPECT_EQ(l_messages[1].m_level, logging::LogLevel::Error);
+}
+
+TEST_F(LoggerTest, MessagesOfEachThreadStayInOrder)
+{
+    constexpr size_t l_threadCount = 4;
+
+    // Fits in the buffer of a thread, so that none is dropped.
+    constexpr size_t l_messageCount = constants::LOG_BUFFER_SIZE / 2;
+
+    std::vector<std::thread> l_threads;
+    for (size_t l_thread = 0; l_thread < l_threadCount; ++l_thread)
+    {
+        l_threads.emplace_back([l_thread]() {
+            for (size_t l_index = 0; l_index < l_messageCount; ++l_index)
+            {
+                logging::logMessage(std::to_string(l_thread) + ":" +
+                                    std::to_string(l_index));
+            }
+        });
+    }
+
+    for (auto& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+
+    const std::vector<CapturedMessage> l_messages =
+        waitForMessages(l_threadCount * l_messageCount);
+    ASSERT_EQ(l_messages.size(), l_threadCount * l_messageCount);
+
+    std::vector<size_t> l_nextIndex(l_threadCount, 0);
+    for (const auto& l_message : l_messages)
+    {
+        const size_t l_separator = l_message.m_message.find(':');
+        ASSERT_NE(l_separator, std::string::npos);
+
+        const size_t l_thread = std::stoul(l_message.m_message);
+        const size_t l_index =
+            std::stoul(l_message.m_message.substr(l_separator + 1));
+
+        ASSERT_LT(l_thread, l_threadCount);
+        EXPECT_EQ(l_index, l_nextIndex[l_thread]++);
+    }
+}
+
+TEST_F(LoggerTest, MessageOfMaxSizeIsNotTruncated)
+{
+    const std::string l_message(constants::LOG_MESSAGE_MAX_SIZE, 'a');
+    logging::logMessage(l_message);
+
+    const std::vector<CapturedMessage> l_messages = waitForMessages(1);
+    ASSERT_EQ(l_messages.size(), 1);
+    EXPECT_EQ(l_messages[0].m_message, l_message);
+}
+
+TEST_F(LoggerTest, LongMessageIsNotTruncated)
+{
+    // Doesn't fit in a record, written directly.
+    const std::string l_message(constants::LOG_MESSAGE_MAX_SIZE + 1, 'b');
+    logging::logMessage(l_message);
+
+    const std::vector<CapturedMessage> l_messages = waitForMessages(1);
+    ASSERT_EQ(l_messages.size(), 1);
+    EXPECT_EQ(l_messages[0].m_message, l_message);
+}
+
+TEST_F(LoggerTest, LevelAboveMaxIsCompiledOut)
+{
+    logging::logMessage<logging::LogLevel::Debug>("debug");
+    logging::logMessage<logging::LogLevel::Error>("error");
+
+    const bool l_isDebugEnabled =
+        (logging::LogLevel::Debug <= logging::MAX_LOG_LEVEL);
+
+    const std::vector<CapturedMessage> l_messages =
+        waitForMessages(l_isDebugEnabled ? 2 : 1);
+
+    // Messages of a thread are drained in order, so the error being there
+    // means the debug message would have been too.
+    ASSERT_EQ(l_messages.size(), l_isDebugEnabled ? 2 : 1);
+    EXPECT_EQ(l_messages.back().m_message, "error");
+    EXPECT_EQ(l_messages.front().m_message,
+              l_isDebugEnabled ? "debug" : "error");
+}
@@ -0,0 +1,117 @@
+#include "parsed_vpd_cache.hpp"
+#include "types.hpp"
+
+#include <string>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+static const std::string eepromPath("/sys/bus/i2c/drivers/at24/8-0050/eeprom");
+
+/**
+ * @brief API to get parsed VPD holding a single keyword.
+ *
+ * @param[in] i_value - Value of the keyword.
+ */
+static types::VPDMapVariant getParsedVpd(const std::string& i_value)
+{
+    return types::KeywordVpdMap{{"PN", i_value}};
+}
+
+TEST(ParsedVpdCacheTest, GetCachedVpd)
+{
+    ParsedVpdCache l_cache;
+    EXPECT_FALSE(l_cache.get(eepromPath).has_value());
+
+    l_cache.put(eepromPath, getParsedVpd("1"),
+                l_cache.getGeneration(eepromPath));
+
+    const auto l_parsedVpd = l_cache.get(eepromPath);
+    ASSERT_TRUE(l_parsedVpd.has_value());
+    EXPECT_EQ(*l_parsedVpd, getParsedVpd("1"));
+}
+
+TEST(ParsedVpdCacheTest, EmptyVpdIsNotCached)
+{
+    ParsedVpdCache l_cache;
+    l_cache.put(eepromPath, std::monostate{}, 0);
+
+    EXPECT_FALSE(l_cache.get(eepromPath).has_value());
+}
+
+TEST(ParsedVpdCacheTest, InvalidateDropsVpd)
+{
+    ParsedVpdCache l_cache;
+    l_cache.put(eepromPath, getParsedVpd("1"), 0);
+    l_cache.invalidate(eepromPath);
+
+    EXPECT_FALSE(l_cache.get(eepromPath).has_value());
+    EXPECT_EQ(l_cache.getGeneration(eepromPath), 1);
+
+    // VPD parsed after the invalidation is cached again.
+    l_cache.put(eepromPath, getParsedVpd("2"),
+                l_cache.getGeneration(eepromPath));
+
+    const auto l_parsedVpd = l_cache.get(eepromPath);
+    ASSERT_TRUE(l_parsedVpd.has_value());
+    EXPECT_EQ(*l_parsedVpd, getParsedVpd("2"));
+}
+
+TEST(ParsedVpdCacheTest, VpdParsedAcrossInvalidationIsNotCached)
+{
+    ParsedVpdCache l_cache;
+
+    // Generation is read before parsing, EEPROM is written while parsing.
+    const uint64_t l_generation = l_cache.getGeneration(eepromPath);
+    l_cache.invalidate(eepromPath);
+    l_cache.put(eepromPath, getParsedVpd("stale"), l_generation);
+
+    EXPECT_FALSE(l_cache.get(eepromPath).has_value());
+}
+
+TEST(ParsedVpdCacheTest, OldestVpdIsDroppedWhenFull)
+{
+    constexpr size_t l_maxEntries = 3;
+    ParsedVpdCache l_cache(l_maxEntries);
+
+    for (size_t l_index = 0; l_index <= l_maxEntries; ++l_index)
+    {
+        l_cache.put(eepromPath + std::to_string(l_index),
+                    getParsedVpd(std::to_string(l_index)), 0);
+    }
+
+    EXPECT_FALSE(l_cache.get(eepromPath + "0").has_value());
+    for (size_t l_index = 1; l_index <= l_maxEntries; ++l_index)
+    {
+        EXPECT_TRUE(l_cache.get(eepromPath + std::to_string(l_index)));
+    }
+}
+
+TEST(ParsedVpdCacheTest, RecachingDoesNotTakeExtraRoom)
+{
+    constexpr size_t l_maxEntries = 2;
+    ParsedVpdCache l_cache(l_maxEntries);
+
+    l_cache.put(eepromPath + "0", getParsedVpd("0"), 0);
+    l_cache.put(eepromPath + "0", getParsedVpd("1"), 0);
+    l_cache.put(eepromPath + "1", getParsedVpd("1"), 0);
+
+    EXPECT_TRUE(l_cache.get(eepromPath + "0").has_value());
+    EXPECT_TRUE(l_cache.get(eepromPath + "1").has_value());
+}
+
+TEST(ParsedVpdCacheTest, InvalidatedVpdFreesRoom)
+{
+    constexpr size_t l_maxEntries = 2;
+    ParsedVpdCache l_cache(l_maxEntries);
+
+    l_cache.put(eepromPath + "0", getParsedVpd("0"), 0);
+    l_cache.put(eepromPath + "1", getParsedVpd("1"), 0);
+    l_cache.invalidate(eepromPath + "1");
+    l_cache.put(eepromPath + "2", getParsedVpd("2"), 0);
+
+    EXPECT_TRUE(l_cache.get(eepromPath + "0").has_value());
+    EXPECT_TRUE(l_cache.get(eepromPath + "2").has_value());
+}
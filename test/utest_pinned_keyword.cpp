@@ -0,0 +1,125 @@
+#include "exceptions.hpp"
+#include "pinned_keyword.hpp"
+#include "types.hpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+/**
+ * @brief Fixture reading keywords through a pinned keyword reader.
+ */
+class PinnedKeywordTest : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief API to read a keyword as a string.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_recordName - Record name.
+     * @param[in] i_keywordName - Keyword name.
+     * @param[in] i_vpdStartOffset - Offset of VPD in the EEPROM.
+     */
+    std::string readKeyword(const std::string& i_vpdFilePath,
+                            const types::Record& i_recordName,
+                            const types::Keyword& i_keywordName,
+                            size_t i_vpdStartOffset = 0)
+    {
+        const types::BinaryVector l_value = m_pinnedKeyword.read(
+            i_vpdFilePath, i_recordName, i_keywordName, i_vpdStartOffset);
+        return std::string(l_value.begin(), l_value.end());
+    }
+
+    PinnedKeyword m_pinnedKeyword;
+};
+
+TEST_F(PinnedKeywordTest, GoodTestCase)
+{
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+
+    EXPECT_EQ(readKeyword(l_vpdFile, "VINI", "DR"), "SYSTEM BACKPLANE");
+    EXPECT_EQ(readKeyword(l_vpdFile, "VINI", "SN"), "Y131UF07300L");
+    EXPECT_EQ(readKeyword(l_vpdFile, "VSYS", "DR"), "SYSTEM");
+}
+
+TEST_F(PinnedKeywordTest, RepeatedRead)
+{
+    // Later reads are served from the pinned location.
+    const std::string l_vpdFile("vpd_files/ipz_system.dat");
+
+    for (int l_count = 0; l_count < 3; ++l_count)
+    {
+        EXPECT_EQ(readKeyword(l_vpdFile, "VINI", "DR"), "SYSTEM BACKPLANE");
+        EXPECT_EQ(readKeyword(l_vpdFile, "VSYS", "DR"), "SYSTEM");
+    }
+}
+
+TEST_F(PinnedKeywordTest, VpdAtOffset)
+{
+    // Same VPD behind a leading area, as on EEPROMs with VPD at an offset.
+    constexpr size_t l_vpdStartOffset = 512;
+
+    std::string l_vpdFile =
+        (std::filesystem::temp_directory_path() / "vpd_pinned_XXXXXX")
+            .string();
+    const int l_fd = mkstemp(l_vpdFile.data());
+    ASSERT_GE(l_fd, 0);
+    close(l_fd);
+
+    {
+        std::ifstream l_source("vpd_files/ipz_system.dat", std::ios::binary);
+        std::ofstream l_target(l_vpdFile, std::ios::binary);
+        l_target << std::string(l_vpdStartOffset, '\0')
+                 << std::string(std::istreambuf_iterator<char>(l_source),
+                                std::istreambuf_iterator<char>());
+    }
+
+    EXPECT_EQ(readKeyword(l_vpdFile, "VINI", "SN", l_vpdStartOffset),
+              "Y131UF07300L");
+
+    std::filesystem::remove(l_vpdFile);
+}
+
+TEST_F(PinnedKeywordTest, VpdFileDoesNotExist)
+{
+    EXPECT_THROW(readKeyword("vpd_files/xyz.dat", "VINI", "DR"),
+                 std::runtime_error);
+}
+
+TEST_F(PinnedKeywordTest, MissingRecord)
+{
+    EXPECT_THROW(readKeyword("vpd_files/ipz_system.dat", "ABCD", "DR"),
+                 DataException);
+}
+
+TEST_F(PinnedKeywordTest, MissingKeyword)
+{
+    EXPECT_THROW(readKeyword("vpd_files/ipz_system.dat", "VINI", "ZZ"),
+                 DataException);
+}
+
+TEST_F(PinnedKeywordTest, InvalidRecordOffset)
+{
+    // VINI record offset corrupted at index[74], fails VTOC ECC check or else
+    // the record is not found.
+    EXPECT_THROW(
+        readKeyword("vpd_files/ipz_system_corrupted_index_74.dat", "VINI",
+                    "DR"),
+        std::exception);
+}
+
+TEST_F(PinnedKeywordTest, TruncatedVpdFile)
+{
+    EXPECT_THROW(
+        readKeyword("vpd_files/ipz_system_truncated.dat", "VINI", "DR"),
+        std::exception);
+}
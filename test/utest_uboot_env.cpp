@@ -0,0 +1,91 @@
+#include "types.hpp"
+#include "uboot_env.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+using namespace std::string_literals;
+
+using Variables = std::vector<std::pair<std::string, std::string>>;
+
+static types::BinaryVector toBinary(const std::string& i_data)
+{
+    return types::BinaryVector(i_data.begin(), i_data.end());
+}
+
+TEST(UBootEnvTest, Crc)
+{
+    EXPECT_EQ(UBootEnv::computeCrc(types::BinaryVector{}), 0);
+    EXPECT_EQ(UBootEnv::computeCrc(toBinary("123456789")), 0xCBF43926);
+    EXPECT_EQ(UBootEnv::computeCrc(toBinary("fieldmode=true")),
+              UBootEnv::computeCrc(toBinary("fieldmode=true")));
+    EXPECT_NE(UBootEnv::computeCrc(toBinary("fieldmode=true")),
+              UBootEnv::computeCrc(toBinary("fieldmode=truf")));
+}
+
+TEST(UBootEnvTest, ParseVariables)
+{
+    // Data area padded to size of the copy.
+    types::BinaryVector l_data =
+        toBinary("bootcmd=bootm\0fitconfig=conf-1\0\0"s);
+    l_data.resize(64, 0xFF);
+
+    const Variables l_expected{{"bootcmd", "bootm"},
+                               {"fitconfig", "conf-1"}};
+    EXPECT_EQ(UBootEnv::parseVariables(l_data), l_expected);
+}
+
+TEST(UBootEnvTest, ParseValueWithSeparator)
+{
+    const Variables l_expected{{"bootargs", "console=ttyS4"}};
+    EXPECT_EQ(
+        UBootEnv::parseVariables(toBinary("bootargs=console=ttyS4\0\0"s)),
+        l_expected);
+}
+
+TEST(UBootEnvTest, ParseSkipsEntryWithoutSeparator)
+{
+    const Variables l_expected{{"a", "1"}, {"b", ""}};
+    EXPECT_EQ(UBootEnv::parseVariables(toBinary("a=1\0junk\0b=\0\0"s)),
+              l_expected);
+}
+
+TEST(UBootEnvTest, ParseEmptyOrUnterminated)
+{
+    EXPECT_TRUE(UBootEnv::parseVariables(types::BinaryVector{}).empty());
+    EXPECT_TRUE(UBootEnv::parseVariables(types::BinaryVector{0, 0}).empty());
+
+    const Variables l_expected{{"a", "1"}};
+    EXPECT_EQ(UBootEnv::parseVariables(toBinary("a=1")), l_expected);
+}
+
+TEST(UBootEnvTest, ActiveCopyHasHigherFlags)
+{
+    EXPECT_EQ(UBootEnv::selectActiveCopy(1, 2), 1);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(2, 1), 0);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0x7F, 0x80), 1);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0xFE, 0xFF), 1);
+}
+
+TEST(UBootEnvTest, ActiveCopyOnFlash)
+{
+    // Flags on flash are active (1) or obsolete (0).
+    EXPECT_EQ(UBootEnv::selectActiveCopy(1, 0), 0);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0, 1), 1);
+}
+
+TEST(UBootEnvTest, ActiveCopyOnTie)
+{
+    EXPECT_EQ(UBootEnv::selectActiveCopy(1, 1), 0);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0xFF, 0xFF), 0);
+}
+
+TEST(UBootEnvTest, ActiveCopyAfterWrapAround)
+{
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0xFF, 0), 1);
+    EXPECT_EQ(UBootEnv::selectActiveCopy(0, 0xFF), 0);
+}
@@ -15,6 +15,80 @@ TEST(UtilsTest, TestValidValue)
     EXPECT_EQ(expected, vpdSpecificUtility::encodeKeyword(key, encoding));
 }
 
+TEST(UtilsTest, PendingBiosAttributeChanges)
+{
+    const types::BiosAttributeValueMap l_lastSeen{
+        {"hb_memory_mirror_mode", std::string("Enabled")},
+        {"hb_field_core_override", int64_t{0}}};
+    types::BiosAttributeValueMap l_pending;
+
+    // Change from last seen is pending.
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        l_lastSeen,
+        {{"hb_memory_mirror_mode", std::string("Disabled")},
+         {"hb_field_core_override", int64_t{0}}},
+        l_pending);
+
+    const types::BiosAttributeValueMap l_expected{
+        {"hb_memory_mirror_mode", std::string("Disabled")}};
+    EXPECT_EQ(l_pending, l_expected);
+
+    // Latest change replaces the pending one.
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        l_lastSeen, {{"hb_field_core_override", int64_t{2}}}, l_pending);
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        l_lastSeen, {{"hb_field_core_override", int64_t{4}}}, l_pending);
+    EXPECT_EQ(std::get<int64_t>(l_pending.at("hb_field_core_override")), 4);
+}
+
+TEST(UtilsTest, BiosAttributeChangedBack)
+{
+    // A -> B -> A before sync leaves nothing to sync.
+    const types::BiosAttributeValueMap l_lastSeen{
+        {"pvm_keep_and_clear", std::string("Disabled")}};
+    types::BiosAttributeValueMap l_pending;
+
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        l_lastSeen, {{"pvm_keep_and_clear", std::string("Enabled")}},
+        l_pending);
+    EXPECT_EQ(l_pending.size(), 1);
+
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        l_lastSeen, {{"pvm_keep_and_clear", std::string("Disabled")}},
+        l_pending);
+    EXPECT_TRUE(l_pending.empty());
+}
+
+TEST(UtilsTest, ChangedKeywords)
+{
+    const types::IpzTypeValueMap l_before{
+        {{"UTIL", "D0"}, {0x01}},
+        {{"UTIL", "D1"}, {0x00}},
+        {{"VSYS", "RG"}, {0x00, 0x00, 0x00, 0x01}}};
+
+    types::IpzTypeValueMap l_after = l_before;
+    EXPECT_TRUE(
+        vpdSpecificUtility::getChangedKeywords(l_before, l_after).empty());
+
+    // Changed and added keywords are reported, unchanged ones are not.
+    l_after[{"UTIL", "D1"}] = {0x02};
+    l_after[{"UTIL", "D8"}] = {0x01};
+
+    const std::set<types::IpzType> l_expected{{"UTIL", "D1"}, {"UTIL", "D8"}};
+    EXPECT_EQ(vpdSpecificUtility::getChangedKeywords(l_before, l_after),
+              l_expected);
+}
+
+TEST(UtilsTest, ChangedKeywordsFromNothing)
+{
+    // Keywords missing in VPD are all to be written.
+    const types::IpzTypeValueMap l_after{{{"UTIL", "D0"}, {0x01}},
+                                         {{"UTIL", "D1"}, {0x00}}};
+
+    const std::set<types::IpzType> l_expected{{"UTIL", "D0"}, {"UTIL", "D1"}};
+    EXPECT_EQ(vpdSpecificUtility::getChangedKeywords({}, l_after), l_expected);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
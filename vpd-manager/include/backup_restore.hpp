@@ -1,9 +1,11 @@
 #pragma once
 
+#include "eeprom_write_queue.hpp"
 #include "types.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
 #include <tuple>
 
 namespace vpd
@@ -36,10 +38,12 @@ class BackupAndRestore
      * @brief Constructor.
      *
      * @param[in] i_sysCfgJsonObj - System config JSON object.
+     * @param[in] i_eepromWriteQueue - Queue to write keywords through.
      *
      * @throw std::runtime_error in case constructor failure.
      */
-    BackupAndRestore(const nlohmann::json& i_sysCfgJsonObj);
+    BackupAndRestore(const nlohmann::json& i_sysCfgJsonObj,
+                     std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue);
 
     /**
      * @brief Default destructor.
@@ -102,6 +106,9 @@ class BackupAndRestore
     /**
      * @brief An API to handle backup and restore of IPZ type VPD.
      *
+     * Keywords of source and destination are compared in a single pass, and
+     * the required updates are written as one batch per EEPROM.
+     *
      * @param[in,out] io_srcVpdMap - Source VPD map.
      * @param[in,out] io_dstVpdMap - Destination VPD map.
      * @param[in] i_srcPath - Source EEPROM file path or inventory path.
@@ -119,6 +126,9 @@ class BackupAndRestore
     // Backup and restore config JSON object.
     nlohmann::json m_backupAndRestoreCfgJsonObj{};
 
+    // Queue to write keywords through.
+    std::shared_ptr<EepromWriteQueue> m_eepromWriteQueue;
+
     // Backup and restore status.
     static BackupAndRestoreStatus m_backupAndRestoreStatus;
 };
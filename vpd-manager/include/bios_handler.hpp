@@ -1,10 +1,16 @@
 #pragma once
+#include "constants.hpp"
+#include "debouncer.hpp"
 #include "manager.hpp"
 #include "types.hpp"
 
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <set>
+#include <string>
+#include <vector>
+
 namespace vpd
 {
 
@@ -50,10 +56,16 @@ class IbmBiosHandler : public BiosHandlerInterface
      * @brief Construct a new IBM BIOS Handler object
      *
      * This constructor constructs a new IBM BIOS Handler object
+     * @param[in] i_connection - Asio connection object.
      * @param[in] i_manager - Manager object.
      */
-    explicit IbmBiosHandler(const std::shared_ptr<Manager>& i_manager) :
-        m_manager(i_manager)
+    IbmBiosHandler(
+        const std::shared_ptr<sdbusplus::asio::connection>& i_connection,
+        const std::shared_ptr<Manager>& i_manager) :
+        m_manager(i_manager),
+        m_debouncer(i_connection->get_io_context(),
+                    std::chrono::milliseconds(
+                        constants::BIOS_ATTRIBUTE_DEBOUNCE_TIME_MS))
     {}
 
     /**
@@ -61,6 +73,9 @@ class IbmBiosHandler : public BiosHandlerInterface
      *
      * The API will read the backed up data from the VPD keyword and based on
      * its value, either backs up or restores the data.
+     * All keywords and attributes are read upfront, the reconciled values are
+     * then written with a single VPD update and a single BIOS pending
+     * attribute update.
      */
     virtual void backUpOrRestoreBiosAttributes();
 
@@ -69,20 +84,100 @@ class IbmBiosHandler : public BiosHandlerInterface
      *
      * The API to extract the required attribute and its value from DBus message
      * broadcasted on BIOS attribute change.
+     * Only attributes whose value differs from the last seen value are
+     * considered. Changes are collected till no change is received for
+     * BIOS_ATTRIBUTE_DEBOUNCE_TIME_MS and then synced to VPD in one go.
      *
      * @param[in] i_msg - The callback message.
      */
     virtual void biosAttributesCallback(sdbusplus::message_t& i_msg);
 
   private:
+    /**
+     * @brief API to decode BIOS attributes from a property change message.
+     *
+     * Only the current value of attributes backed up in VPD are decoded from
+     * "BaseBIOSTable", rest of the table is skipped.
+     *
+     * @param[in] i_msg - The callback message.
+     *
+     * @throw std::runtime_error if the message could not be decoded.
+     *
+     * @return Map of attribute name to its current value.
+     */
+    types::BiosAttributeValueMap decodeBiosAttributes(
+        sdbusplus::message_t& i_msg);
+
+    /**
+     * @brief API to sync BIOS attributes changed since last sync to VPD.
+     *
+     * Keywords backing the attributes are read once and all changes are
+     * written to VPD in a single batch. An attribute is marked as seen only
+     * if all of its keywords got updated.
+     */
+    void syncChangedAttributesToVpd();
+
+    /**
+     * @brief API to apply a BIOS attribute on keywords backing it.
+     *
+     * Attributes not backed up in VPD are ignored.
+     *
+     * @param[in] i_attributeName - Attribute name.
+     * @param[in] i_value - Attribute value.
+     * @param[in,out] io_keywords - Keyword values to be in VPD.
+     */
+    void saveAttributeToVpd(const std::string& i_attributeName,
+                            const types::BiosAttributeCurrentValue& i_value,
+                            types::IpzTypeValueMap& io_keywords);
+
+    /**
+     * @brief API to read VPD keywords backing the BIOS attributes.
+     *
+     * Keywords are read from PIM with a single call per record.
+     *
+     * @return Map of (record, keyword) to its value. Keywords which could not
+     * be read are not part of the map.
+     */
+    types::IpzTypeValueMap readBiosKeywordsFromVpd();
+
+    /**
+     * @brief API to write keywords to VPD.
+     *
+     * Only keywords whose value differs from the VPD are written, all of them
+     * in a single batch. Failure of a keyword doesn't affect the others.
+     *
+     * @param[in] i_vpdKeywords - Keyword values read from VPD.
+     * @param[in] i_updatedKeywords - Keyword values to be in VPD.
+     *
+     * @return Keywords which failed to update.
+     */
+    std::set<types::IpzType> writeBiosKeywordsToVpd(
+        const types::IpzTypeValueMap& i_vpdKeywords,
+        const types::IpzTypeValueMap& i_updatedKeywords);
+
+    /**
+     * @brief API to write attributes to BIOS pending attribute table.
+     *
+     * All the attributes are written with a single "PendingAttributes" update.
+     *
+     * @param[in] i_pendingAttributes - Attributes to be written.
+     */
+    void writePendingAttributesToBios(
+        const types::PendingBIOSAttrs& i_pendingAttributes);
+
     /**
      * @brief API to read given attribute from BIOS table.
      *
+     * The attribute is looked up in the given attributes and read from BIOS
+     * only if not found.
+     *
      * @param[in] attributeName - Attribute to be read.
+     * @param[in] i_biosAttributes - Attributes already read from BIOS.
      * @return - Bios attribute current value.
      */
     types::BiosAttributeCurrentValue readBiosAttribute(
-        const std::string& attributeName);
+        const std::string& attributeName,
+        const types::BiosAttributeValueMap& i_biosAttributes);
 
     /**
      * @brief API to process "hb_field_core_override" attribute.
@@ -90,36 +185,51 @@ class IbmBiosHandler : public BiosHandlerInterface
      * The API checks value stored in VPD. If found default then the BIOS value
      * is saved to VPD else VPD value is restored in BIOS pending attribute
      * table.
+     *
+     * @param[in] i_biosAttributes - Attributes read from BIOS.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void processFieldCoreOverride();
+    void processFieldCoreOverride(
+        const types::BiosAttributeValueMap& i_biosAttributes,
+        types::IpzTypeValueMap& io_vpdKeywords,
+        types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save FCO data into VPD.
      *
      * @param[in] i_fcoInBios - FCO value.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
      */
-    void saveFcoToVpd(int64_t i_fcoInBios);
+    void saveFcoToVpd(int64_t i_fcoInBios,
+                      types::IpzTypeValueMap& io_vpdKeywords);
 
     /**
      * @brief API to save given value to "hb_field_core_override" attribute.
      *
      * @param[in] i_fcoVal - FCO value.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void saveFcoToBios(const types::BinaryVector& i_fcoVal);
+    void saveFcoToBios(const types::BinaryVector& i_fcoVal,
+                       types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save AMM data into VPD.
      *
      * @param[in] i_memoryMirrorMode - Memory mirror mode value.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
      */
-    void saveAmmToVpd(const std::string& i_memoryMirrorMode);
+    void saveAmmToVpd(const std::string& i_memoryMirrorMode,
+                      types::IpzTypeValueMap& io_vpdKeywords);
 
     /**
      * @brief API to save given value to "hb_memory_mirror_mode" attribute.
      *
      * @param[in] i_ammVal - AMM value.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void saveAmmToBios(const uint8_t& i_ammVal);
+    void saveAmmToBios(const uint8_t& i_ammVal,
+                       types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to process "hb_memory_mirror_mode" attribute.
@@ -127,78 +237,125 @@ class IbmBiosHandler : public BiosHandlerInterface
      * The API checks value stored in VPD. If found default then the BIOS value
      * is saved to VPD else VPD value is restored in BIOS pending attribute
      * table.
+     *
+     * @param[in] i_biosAttributes - Attributes read from BIOS.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void processActiveMemoryMirror();
+    void processActiveMemoryMirror(
+        const types::BiosAttributeValueMap& i_biosAttributes,
+        types::IpzTypeValueMap& io_vpdKeywords,
+        types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to process "pvm_create_default_lpar" attribute.
      *
      * The API reads the value from VPD and restore it to the BIOS attribute
      * in BIOS pending attribute table.
+     *
+     * @param[in] i_vpdKeywords - Keyword values read from VPD.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void processCreateDefaultLpar();
+    void processCreateDefaultLpar(
+        const types::IpzTypeValueMap& i_vpdKeywords,
+        types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to "pvm_create_default_lpar" attribute.
      *
      * @param[in] i_createDefaultLparVal - Value to be saved;
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void saveCreateDefaultLparToBios(const std::string& i_createDefaultLparVal);
+    void saveCreateDefaultLparToBios(
+        const std::string& i_createDefaultLparVal,
+        types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to VPD.
      *
      * @param[in] i_createDefaultLparVal - Value to be saved.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
      *
      */
-    void saveCreateDefaultLparToVpd(const std::string& i_createDefaultLparVal);
+    void saveCreateDefaultLparToVpd(const std::string& i_createDefaultLparVal,
+                                    types::IpzTypeValueMap& io_vpdKeywords);
 
     /**
      * @brief API to process "pvm_clear_nvram" attribute.
      *
      * The API reads the value from VPD and restores it to the BIOS pending
      * attribute table.
+     *
+     * @param[in] i_vpdKeywords - Keyword values read from VPD.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void processClearNvram();
+    void processClearNvram(const types::IpzTypeValueMap& i_vpdKeywords,
+                           types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to "pvm_clear_nvram" attribute.
      *
      * @param[in] i_clearNvramVal - Value to be saved.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void saveClearNvramToBios(const std::string& i_clearNvramVal);
+    void saveClearNvramToBios(const std::string& i_clearNvramVal,
+                              types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to VPD.
      *
      * @param[in] i_clearNvramVal - Value to be saved.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
      */
-    void saveClearNvramToVpd(const std::string& i_clearNvramVal);
+    void saveClearNvramToVpd(const std::string& i_clearNvramVal,
+                             types::IpzTypeValueMap& io_vpdKeywords);
 
     /**
      * @brief API to process "pvm_keep_and_clear" attribute.
      *
      * The API reads the value from VPD and restore it to the BIOS pending
      * attribute table.
+     *
+     * @param[in] i_vpdKeywords - Keyword values read from VPD.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void processKeepAndClear();
+    void processKeepAndClear(const types::IpzTypeValueMap& i_vpdKeywords,
+                             types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to "pvm_keep_and_clear" attribute.
      *
      * @param[in] i_KeepAndClearVal - Value to be saved.
+     * @param[in,out] io_pendingAttributes - Attributes to be written to BIOS.
      */
-    void saveKeepAndClearToBios(const std::string& i_KeepAndClearVal);
+    void saveKeepAndClearToBios(const std::string& i_KeepAndClearVal,
+                                types::PendingBIOSAttrs& io_pendingAttributes);
 
     /**
      * @brief API to save given value to VPD.
      *
      * @param[in] i_KeepAndClearVal - Value to be saved.
+     * @param[in,out] io_vpdKeywords - Keyword values to be in VPD.
      */
-    void saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal);
+    void saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal,
+                               types::IpzTypeValueMap& io_vpdKeywords);
 
     // const reference to shared pointer to Manager object.
     const std::shared_ptr<Manager>& m_manager;
+
+    // BIOS attributes backed up in VPD.
+    static inline const std::vector<std::string> m_biosAttributes{
+        "hb_field_core_override", "hb_memory_mirror_mode",
+        "pvm_create_default_lpar", "pvm_clear_nvram", "pvm_keep_and_clear"};
+
+    // Last seen current value of BIOS attributes, which are in sync with VPD.
+    types::BiosAttributeValueMap m_lastSeenAttributes;
+
+    // BIOS attributes changed but not yet synced to VPD.
+    types::BiosAttributeValueMap m_changedAttributes;
+
+    // Debounces BIOS attribute changes.
+    Debouncer m_debouncer;
 };
 
 /**
@@ -242,7 +399,8 @@ class BiosHandler
     {
         try
         {
-            m_specificBiosHandler = std::make_shared<T>(i_manager);
+            m_specificBiosHandler =
+                std::make_shared<T>(i_connection, i_manager);
             checkAndListenPldmService();
         }
         catch (std::exception& l_ex)
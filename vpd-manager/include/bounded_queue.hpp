@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace vpd
+{
+/**
+ * @brief Bounded lock free queue.
+ *
+ * Fixed size ring buffer where each slot carries a sequence number telling
+ * whether it is free to be written or ready to be read. Any number of threads
+ * can push and pop concurrently without taking a lock, a push on a full queue
+ * fails instead of blocking.
+ *
+ * @tparam T - Type of element, should be default constructible and movable.
+ * @tparam Capacity - Number of elements, should be a power of two.
+ */
+template <typename T, size_t Capacity>
+class BoundedQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity of bounded queue should be a power of two.");
+
+  public:
+    /**
+     * List of deleted functions.
+     */
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    /**
+     * @brief Constructor.
+     */
+    BoundedQueue()
+    {
+        for (size_t l_index = 0; l_index < Capacity; ++l_index)
+        {
+            m_slots[l_index].m_sequence.store(l_index,
+                                              std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~BoundedQueue() = default;
+
+    /**
+     * @brief API to push an element to the queue.
+     *
+     * @param[in] i_value - Element to be pushed.
+     *
+     * @return true if pushed, false if the queue is full.
+     */
+    bool tryPush(T&& i_value) noexcept
+    {
+        size_t l_position = m_pushPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& l_slot = m_slots[l_position & (Capacity - 1)];
+            const size_t l_sequence =
+                l_slot.m_sequence.load(std::memory_order_acquire);
+            const auto l_difference = static_cast<intptr_t>(l_sequence) -
+                                      static_cast<intptr_t>(l_position);
+
+            if (l_difference == 0)
+            {
+                // Slot is free, claim it.
+                if (m_pushPosition.compare_exchange_weak(
+                        l_position, l_position + 1, std::memory_order_relaxed))
+                {
+                    l_slot.m_value = std::move(i_value);
+                    l_slot.m_sequence.store(l_position + 1,
+                                            std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (l_difference < 0)
+            {
+                // Slot is yet to be read, queue is full.
+                return false;
+            }
+            else
+            {
+                // Another thread claimed the slot.
+                l_position = m_pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief API to pop an element from the queue.
+     *
+     * @param[out] o_value - Element popped.
+     *
+     * @return true if popped, false if the queue is empty.
+     */
+    bool tryPop(T& o_value) noexcept
+    {
+        size_t l_position = m_popPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& l_slot = m_slots[l_position & (Capacity - 1)];
+            const size_t l_sequence =
+                l_slot.m_sequence.load(std::memory_order_acquire);
+            const auto l_difference = static_cast<intptr_t>(l_sequence) -
+                                      static_cast<intptr_t>(l_position + 1);
+
+            if (l_difference == 0)
+            {
+                // Slot is ready, claim it.
+                if (m_popPosition.compare_exchange_weak(
+                        l_position, l_position + 1, std::memory_order_relaxed))
+                {
+                    o_value = std::move(l_slot.m_value);
+                    l_slot.m_sequence.store(l_position + Capacity,
+                                            std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (l_difference < 0)
+            {
+                // Slot is yet to be written, queue is empty.
+                return false;
+            }
+            else
+            {
+                // Another thread claimed the slot.
+                l_position = m_popPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    /**
+     * @brief An element of the queue along with its sequence number.
+     */
+    struct Slot
+    {
+        std::atomic<size_t> m_sequence{0};
+        T m_value{};
+    };
+
+    std::array<Slot, Capacity> m_slots;
+
+    // Positions are kept on separate cache lines as producers and consumer
+    // update them independently.
+    alignas(64) std::atomic<size_t> m_pushPosition{0};
+    alignas(64) std::atomic<size_t> m_popPosition{0};
+};
+} // namespace vpd
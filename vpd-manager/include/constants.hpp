@@ -164,6 +164,12 @@ constexpr auto objectMapperInf = "xyz.openbmc_project.ObjectMapper";
 constexpr auto systemVpdInvPath =
     "/xyz/openbmc_project/inventory/system/chassis/motherboard";
 constexpr auto assetTagInf = "xyz.openbmc_project.Inventory.Decorator.AssetTag";
+constexpr auto chassisStateService = "xyz.openbmc_project.State.Chassis";
+constexpr auto chassisStateObjectPath = "/xyz/openbmc_project/state/chassis0";
+constexpr auto chassisStateInterface = "xyz.openbmc_project.State.Chassis";
+constexpr auto currentPowerStateProperty = "CurrentPowerState";
+constexpr auto chassisPowerOnState =
+    "xyz.openbmc_project.State.Chassis.PowerState.On";
 constexpr auto hostObjectPath = "/xyz/openbmc_project/state/host0";
 constexpr auto hostInterface = "xyz.openbmc_project.State.Host";
 constexpr auto hostService = "xyz.openbmc_project.State.Host";
@@ -201,6 +207,45 @@ static constexpr auto STR_CMP_SUCCESS = 0;
 // Just a random value. Can be adjusted as required.
 static constexpr uint8_t MAX_THREADS = 10;
 
+// Max PIM notify calls in flight while collecting FRUs.
+static constexpr uint8_t MAX_PIM_NOTIFY_IN_FLIGHT = 8;
+
+// Number of threads serving D-Bus requests which access hardware.
+static constexpr uint8_t IO_WORKER_POOL_SIZE = 4;
+
+// Number of strands ordering tasks on EEPROMs in the I/O worker pool.
+static constexpr uint8_t EEPROM_STRAND_COUNT = 16;
+
+// Max EEPROMs whose parsed VPD is kept cached for D-Bus reads.
+static constexpr uint8_t MAX_PARSED_VPD_CACHE_ENTRIES = 16;
+
+// Quiet time after a BIOS attribute change before it is synced to VPD.
+static constexpr auto BIOS_ATTRIBUTE_DEBOUNCE_TIME_MS = 500;
+
+// Max PELs waiting to be created, should be a power of two.
+static constexpr size_t PEL_QUEUE_SIZE = 64;
+
+// Identical PELs created within this window are merged into one.
+static constexpr auto PEL_DEDUP_WINDOW_SEC = 60;
+
+// Max log messages buffered per thread, should be a power of two.
+static constexpr size_t LOG_BUFFER_SIZE = 64;
+
+// Log messages longer than this bypass the buffer.
+static constexpr size_t LOG_MESSAGE_MAX_SIZE = 384;
+
+// Interval at which buffered log messages are written to journal.
+static constexpr auto LOG_DRAIN_INTERVAL_MS = 100;
+
+// Time a presence GPIO should be stable for before the change is acted upon.
+static constexpr auto GPIO_PRESENCE_DEBOUNCE_TIME_MS = 200;
+
+// Max time to wait for an EEPROM to appear once its pre-action is done.
+static constexpr auto EEPROM_APPEARANCE_TIMEOUT_MS = 5000;
+
+// Describes storage of U-Boot environment, as used by fw_printenv.
+constexpr auto ubootEnvConfigPath = "/etc/fw_env.config";
+
 static constexpr auto FAILURE = -1;
 static constexpr auto SUCCESS = 0;
 
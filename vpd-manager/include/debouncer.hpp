@@ -0,0 +1,94 @@
+#pragma once
+
+#include "logger.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace vpd
+{
+/**
+ * @brief Class to run an action once a burst of triggers settles.
+ *
+ * Every trigger restarts a quiet period, the action of the latest trigger is
+ * run on the io context once no trigger is received for the quiet period.
+ *
+ * APIs are to be called from the thread running the io context.
+ */
+class Debouncer
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    Debouncer(const Debouncer&) = delete;
+    Debouncer& operator=(const Debouncer&) = delete;
+    Debouncer(Debouncer&&) = delete;
+    Debouncer& operator=(Debouncer&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_ioContext - io context to run the action on.
+     * @param[in] i_quietPeriod - Time without triggers after which the action
+     * is run.
+     */
+    Debouncer(boost::asio::io_context& i_ioContext,
+              const std::chrono::milliseconds i_quietPeriod) :
+        m_timer(i_ioContext), m_quietPeriod(i_quietPeriod)
+    {}
+
+    /**
+     * @brief Destructor, drops the action if it is yet to run.
+     */
+    ~Debouncer() = default;
+
+    /**
+     * @brief API to (re)start the quiet period.
+     *
+     * @param[in] i_action - Action to run once the quiet period is over, it
+     * replaces the action of any earlier trigger.
+     */
+    void trigger(std::function<void()> i_action)
+    {
+        m_action = std::move(i_action);
+
+        // Restarting the timer aborts the wait of an earlier trigger.
+        m_timer.expires_after(m_quietPeriod);
+        m_timer.async_wait([this](const boost::system::error_code& l_ec) {
+            if (l_ec == boost::asio::error::operation_aborted)
+            {
+                return;
+            }
+
+            if (l_ec)
+            {
+                logging::logMessage("Debounce timer failed with error: " +
+                                    l_ec.message());
+            }
+
+            // Cleared before the run, so the action can trigger again.
+            std::function<void()> l_action = std::exchange(m_action, nullptr);
+            if (l_action)
+            {
+                l_action();
+            }
+        });
+    }
+
+  private:
+    // Timer for the quiet period.
+    boost::asio::steady_timer m_timer;
+
+    // Length of the quiet period.
+    const std::chrono::milliseconds m_quietPeriod;
+
+    // Action of the latest trigger.
+    std::function<void()> m_action;
+};
+} // namespace vpd
@@ -0,0 +1,305 @@
+#pragma once
+
+#include "logger.hpp"
+
+#include <linux/netlink.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace vpd
+{
+/**
+ * @brief Class to wait for an EEPROM to appear.
+ *
+ * An EEPROM behind a mux or an unbound driver shows up in sysfs only after its
+ * pre-action is done, and it may take a while for the driver to probe it.
+ * Kernel uevents are listened to, and waiters check for their EEPROM every
+ * time a device is added or bound to a driver, instead of polling for it.
+ *
+ * If uevents can't be listened to, waiters only check for the EEPROM once.
+ *
+ * All APIs are thread safe.
+ */
+class EepromWatcher
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    EepromWatcher(const EepromWatcher&) = delete;
+    EepromWatcher& operator=(const EepromWatcher&) = delete;
+    EepromWatcher(EepromWatcher&&) = delete;
+    EepromWatcher& operator=(EepromWatcher&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * Uevents are listened to only once an EEPROM is waited for.
+     */
+    EepromWatcher() = default;
+
+    /**
+     * @brief Destructor, stops listening to uevents.
+     *
+     * Waiters, if any, are woken up and check for their EEPROM once more.
+     */
+    ~EepromWatcher()
+    {
+        std::thread l_listener;
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            l_listener = std::move(m_listener);
+
+            if (l_listener.joinable())
+            {
+                const uint64_t l_stop = 1;
+                if (::write(m_stopEventFd, &l_stop, sizeof(l_stop)) < 0)
+                {
+                    logging::logMessage(
+                        "Failed to stop uevent listener, error: " +
+                        std::string(std::strerror(errno)));
+                }
+            }
+        }
+
+        if (l_listener.joinable())
+        {
+            l_listener.join();
+        }
+
+        if (m_stopEventFd >= 0)
+        {
+            close(m_stopEventFd);
+        }
+    }
+
+    /**
+     * @brief API to wait for an EEPROM to appear.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_timeout - Max time to wait for.
+     *
+     * @return true if the EEPROM exists, false if it didn't appear in time.
+     */
+    bool waitForEeprom(const std::string& i_eepromPath,
+                       const std::chrono::milliseconds i_timeout)
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+
+        if (!m_isListenerStarted)
+        {
+            m_isListenerStarted = true;
+            m_isListening = startListener();
+        }
+
+        // Checked under the lock, so that an event after the check can't be
+        // missed.
+        std::error_code l_ec;
+        if (std::filesystem::exists(i_eepromPath, l_ec))
+        {
+            return true;
+        }
+
+        if (!m_isListening)
+        {
+            return false;
+        }
+
+        const auto l_deadline = std::chrono::steady_clock::now() + i_timeout;
+        uint64_t l_seenGeneration = m_generation;
+
+        while (true)
+        {
+            const bool l_isWokenUp =
+                m_cv.wait_until(l_lock, l_deadline, [this, l_seenGeneration] {
+                    return m_generation != l_seenGeneration || !m_isListening;
+                });
+
+            if (!l_isWokenUp ||
+                std::filesystem::exists(i_eepromPath, l_ec) || !m_isListening)
+            {
+                break;
+            }
+            l_seenGeneration = m_generation;
+        }
+
+        return std::filesystem::exists(i_eepromPath, l_ec);
+    }
+
+  private:
+    /**
+     * @brief API to open the uevent socket and start listening on it.
+     *
+     * Caller should hold m_mutex.
+     *
+     * @return true if listening, false otherwise.
+     */
+    bool startListener() noexcept
+    {
+        const int l_socket = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC,
+                                    NETLINK_KOBJECT_UEVENT);
+        if (l_socket < 0)
+        {
+            logging::logMessage(
+                "Failed to open uevent socket, error: " +
+                std::string(std::strerror(errno)));
+            return false;
+        }
+
+        sockaddr_nl l_address{};
+        l_address.nl_family = AF_NETLINK;
+        l_address.nl_groups = 1; // Kernel uevents.
+
+        if (bind(l_socket, reinterpret_cast<sockaddr*>(&l_address),
+                 sizeof(l_address)) < 0)
+        {
+            logging::logMessage(
+                "Failed to bind uevent socket, error: " +
+                std::string(std::strerror(errno)));
+            close(l_socket);
+            return false;
+        }
+
+        m_stopEventFd = eventfd(0, EFD_CLOEXEC);
+        if (m_stopEventFd < 0)
+        {
+            logging::logMessage(
+                "Failed to create uevent listener stop event, error: " +
+                std::string(std::strerror(errno)));
+            close(l_socket);
+            return false;
+        }
+
+        try
+        {
+            m_listener =
+                std::thread([this, l_socket] { processUevents(l_socket); });
+        }
+        catch (const std::exception& l_ex)
+        {
+            logging::logMessage(
+                "Failed to start uevent listener, error: " +
+                std::string(l_ex.what()));
+            close(m_stopEventFd);
+            m_stopEventFd = -1;
+            close(l_socket);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief API to listen to uevents and wake up the waiters.
+     *
+     * Listens till the stop event is signalled or the socket fails.
+     *
+     * @param[in] i_socket - Uevent socket.
+     */
+    void processUevents(const int i_socket) noexcept
+    {
+        std::array<char, 8192> l_buffer;
+        std::array<pollfd, 2> l_pollFds{
+            {{i_socket, POLLIN, 0}, {m_stopEventFd, POLLIN, 0}}};
+
+        while (true)
+        {
+            if (poll(l_pollFds.data(), l_pollFds.size(), -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                logging::logMessage(
+                    "Stopped listening to uevents, poll error: " +
+                    std::string(std::strerror(errno)));
+                break;
+            }
+
+            if (l_pollFds[1].revents != 0)
+            {
+                break;
+            }
+
+            const ssize_t l_length =
+                recv(i_socket, l_buffer.data(), l_buffer.size(), MSG_DONTWAIT);
+
+            if (l_length < 0)
+            {
+                if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    continue;
+                }
+
+                if (errno != ENOBUFS)
+                {
+                    logging::logMessage(
+                        "Stopped listening to uevents, error: " +
+                        std::string(std::strerror(errno)));
+                    break;
+                }
+
+                // Events were dropped, let the waiters check anyway.
+            }
+            else
+            {
+                // Event starts with "<action>@<devpath>".
+                const std::string_view l_event(
+                    l_buffer.data(), strnlen(l_buffer.data(),
+                                             static_cast<size_t>(l_length)));
+
+                if (!l_event.starts_with("add@") &&
+                    !l_event.starts_with("bind@"))
+                {
+                    continue;
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> l_lock(m_mutex);
+                ++m_generation;
+            }
+            m_cv.notify_all();
+        }
+
+        close(i_socket);
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_isListening = false;
+        }
+        m_cv.notify_all();
+    }
+
+    // Guards the members below.
+    std::mutex m_mutex;
+
+    // Notified on every device added or bound, and when listening stops.
+    std::condition_variable m_cv;
+
+    // Bumped on every device added or bound.
+    uint64_t m_generation = 0;
+
+    bool m_isListenerStarted = false;
+    bool m_isListening = false;
+
+    // Thread listening to uevents.
+    std::thread m_listener;
+
+    // Signalled to stop the listener.
+    int m_stopEventFd = -1;
+};
+} // namespace vpd
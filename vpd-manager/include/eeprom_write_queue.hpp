@@ -0,0 +1,316 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to serialise keyword writes on an EEPROM.
+ *
+ * Writes to VPD at an offset of an EEPROM are queued and performed in the
+ * order they are submitted. The first writer to find the queue idle performs
+ * the writes, other writers wait for their result. Writes submitted while a
+ * batch is in progress are taken together in the next batch, so that a burst
+ * of writes costs a single read and a single ECC update per record of the
+ * EEPROM. Queue is removed once it is idle.
+ *
+ * Writes are serialised only among the writers sharing an object, hence a
+ * single object is meant to be shared by all the writers in a process.
+ *
+ * All APIs are thread safe.
+ */
+class EepromWriteQueue
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    EepromWriteQueue(const EepromWriteQueue&) = delete;
+    EepromWriteQueue& operator=(const EepromWriteQueue&) = delete;
+    EepromWriteQueue(EepromWriteQueue&&) = delete;
+    EepromWriteQueue& operator=(EepromWriteQueue&&) = delete;
+
+    /**
+     * @brief Constructor.
+     */
+    EepromWriteQueue() = default;
+
+    // Writes a batch of keywords on an EEPROM and returns result of each.
+    using BatchWriter = std::function<std::vector<types::WriteResult>(
+        const std::vector<types::WriteVpdParams>&)>;
+
+    // Told of each keyword written successfully, with the EEPROM path.
+    using WriteListener = std::function<void(const std::string&,
+                                             const types::WriteVpdParams&)>;
+
+    /**
+     * @brief API to set listener for successful keyword writes.
+     *
+     * Listener is called on the writing thread before the writer's caller is
+     * answered, so that anything cached against the EEPROM is in sync by the
+     * time the write returns. It must not write through the queue itself.
+     *
+     * @param[in] i_writeListener - Listener, empty to remove it.
+     */
+    void setWriteListener(WriteListener i_writeListener)
+    {
+        std::lock_guard<std::mutex> l_lock(m_listenerMutex);
+        m_writeListener = std::move(i_writeListener);
+    }
+
+    /**
+     * @brief API to write a keyword through the EEPROM's queue.
+     *
+     * Blocks till the keyword is written. The given batch writer is used if
+     * the caller ends up performing the writes, and may be passed writes
+     * submitted by other callers on the same VPD, hence must depend only on
+     * the EEPROM path and VPD offset.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_vpdStartOffset - Offset of VPD in the EEPROM.
+     * @param[in] i_paramsToWriteData - Data required to perform write.
+     * @param[in] i_batchWriter - Writer for a batch of keywords on the EEPROM.
+     *
+     * @throw Exception thrown while writing the keyword.
+     *
+     * @return Number of bytes written.
+     */
+    int write(const std::string& i_eepromPath, size_t i_vpdStartOffset,
+              const types::WriteVpdParams& i_paramsToWriteData,
+              const BatchWriter& i_batchWriter)
+    {
+        const types::WriteResult l_result =
+            writeBatch(i_eepromPath, i_vpdStartOffset, {i_paramsToWriteData},
+                       i_batchWriter)
+                .front();
+
+        if (!l_result.has_value())
+        {
+            std::rethrow_exception(l_result.error());
+        }
+        return l_result.value();
+    }
+
+    /**
+     * @brief API to write multiple keywords through the EEPROM's queue.
+     *
+     * Keywords are queued together, in the given order, so that they are
+     * written in the same batch unless a batch is already in progress.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_vpdStartOffset - Offset of VPD in the EEPROM.
+     * @param[in] i_paramsToWriteData - List of data required to perform write.
+     * @param[in] i_batchWriter - Writer for a batch of keywords on the EEPROM.
+     *
+     * @return Result of each write, in the order of the given list.
+     */
+    std::vector<types::WriteResult> writeBatch(
+        const std::string& i_eepromPath, size_t i_vpdStartOffset,
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData,
+        const BatchWriter& i_batchWriter)
+    {
+        std::vector<std::future<int>> l_futures;
+        l_futures.reserve(i_paramsToWriteData.size());
+
+        const QueueKey l_queueKey{i_eepromPath, i_vpdStartOffset};
+        bool l_isWriter = false;
+        {
+            std::lock_guard<std::mutex> l_lock(m_queuesMutex);
+            Queue& l_queue = m_queues[l_queueKey];
+
+            for (const auto& l_paramsToWriteData : i_paramsToWriteData)
+            {
+                auto l_pendingWrite =
+                    std::make_shared<PendingWrite>(l_paramsToWriteData);
+                l_futures.push_back(l_pendingWrite->m_result.get_future());
+                l_queue.m_pendingWrites.push_back(std::move(l_pendingWrite));
+            }
+
+            // Else active writer will pick them up.
+            if (!l_queue.m_isWriterActive)
+            {
+                l_queue.m_isWriterActive = true;
+                l_isWriter = true;
+            }
+        }
+
+        if (l_isWriter)
+        {
+            processQueue(l_queueKey, i_batchWriter);
+        }
+
+        std::vector<types::WriteResult> l_results;
+        l_results.reserve(l_futures.size());
+        for (auto& l_future : l_futures)
+        {
+            try
+            {
+                l_results.emplace_back(l_future.get());
+            }
+            catch (const std::exception&)
+            {
+                l_results.emplace_back(
+                    std::unexpected(std::current_exception()));
+            }
+        }
+        return l_results;
+    }
+
+  private:
+    /**
+     * @brief A write waiting to be performed.
+     */
+    struct PendingWrite
+    {
+        explicit PendingWrite(const types::WriteVpdParams& i_params) :
+            m_params(i_params)
+        {}
+
+        types::WriteVpdParams m_params;
+        std::promise<int> m_result;
+    };
+
+    /**
+     * @brief Write queue of VPD on an EEPROM.
+     */
+    struct Queue
+    {
+        std::deque<std::shared_ptr<PendingWrite>> m_pendingWrites;
+        bool m_isWriterActive = false;
+    };
+
+    // EEPROM path and VPD offset a queue is for.
+    using QueueKey = std::pair<std::string, size_t>;
+
+    /**
+     * @brief API to notify listener of a successful keyword write.
+     *
+     * Failure of the listener doesn't affect result of the write.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_paramsToWriteData - Data written.
+     */
+    void notifyWrite(const std::string& i_eepromPath,
+                     const types::WriteVpdParams& i_paramsToWriteData)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> l_lock(m_listenerMutex);
+            if (m_writeListener)
+            {
+                m_writeListener(i_eepromPath, i_paramsToWriteData);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // Listener failure is not a write failure.
+        }
+    }
+
+    /**
+     * @brief API to perform pending writes in batches till queue is empty.
+     *
+     * Queue is removed once it is found empty.
+     *
+     * @param[in] i_queueKey - EEPROM path and VPD offset of the queue.
+     * @param[in] i_batchWriter - Writer for a batch of keywords on the EEPROM.
+     */
+    void processQueue(const QueueKey& i_queueKey,
+                      const BatchWriter& i_batchWriter)
+    {
+        const std::string& l_eepromPath = i_queueKey.first;
+
+        while (true)
+        {
+            std::deque<std::shared_ptr<PendingWrite>> l_batch;
+            {
+                std::lock_guard<std::mutex> l_lock(m_queuesMutex);
+                auto l_itrToQueue = m_queues.find(i_queueKey);
+                if (l_itrToQueue->second.m_pendingWrites.empty())
+                {
+                    // Next writer creates it afresh.
+                    m_queues.erase(l_itrToQueue);
+                    return;
+                }
+                l_batch.swap(l_itrToQueue->second.m_pendingWrites);
+            }
+
+            std::vector<types::WriteVpdParams> l_params;
+            l_params.reserve(l_batch.size());
+            for (const auto& l_pendingWrite : l_batch)
+            {
+                l_params.push_back(l_pendingWrite->m_params);
+            }
+
+            try
+            {
+                std::vector<types::WriteResult> l_results =
+                    i_batchWriter(l_params);
+
+                if (l_results.size() != l_batch.size())
+                {
+                    throw std::runtime_error(
+                        "Result count mismatch for batch of keyword writes.");
+                }
+
+                for (size_t l_index = 0; l_index < l_batch.size(); ++l_index)
+                {
+                    if (l_results[l_index].has_value())
+                    {
+                        notifyWrite(l_eepromPath, l_params[l_index]);
+                        l_batch[l_index]->m_result.set_value(
+                            l_results[l_index].value());
+                    }
+                    else
+                    {
+                        l_batch[l_index]->m_result.set_exception(
+                            l_results[l_index].error());
+                    }
+                }
+            }
+            catch (const std::exception&)
+            {
+                // Batch failed as a whole, fail the writes yet to be answered.
+                const std::exception_ptr l_exception = std::current_exception();
+
+                for (const auto& l_pendingWrite : l_batch)
+                {
+                    try
+                    {
+                        l_pendingWrite->m_result.set_exception(l_exception);
+                    }
+                    catch (const std::future_error&)
+                    {
+                        // Result already set.
+                    }
+                }
+            }
+        }
+    }
+
+    // Mutex to guard m_queues.
+    std::mutex m_queuesMutex;
+
+    // Queues with writes pending or in progress, against EEPROM path and VPD
+    // offset.
+    std::map<QueueKey, Queue> m_queues;
+
+    // Mutex to guard m_writeListener.
+    std::mutex m_listenerMutex;
+
+    // Listener for successful keyword writes.
+    WriteListener m_writeListener;
+};
+} // namespace vpd
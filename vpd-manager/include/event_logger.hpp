@@ -164,7 +164,9 @@ class EventLogger
     /**
      * @brief An API to create PEL.
      *
-     * This API makes synchronous call to phosphor-logging Create method.
+     * This API makes synchronous call to phosphor-logging Create method, PEL
+     * is created by the time it returns. Use it when the caller is about to
+     * exit or depends on the PEL being there.
      *
      * @param[in] i_errorType - Enum to map with event message name.
      * @param[in] i_severity - Severity of the event.
@@ -190,7 +192,89 @@ class EventLogger
         const std::optional<std::string> i_symFru,
         const std::optional<std::string> i_procedure);
 
+    /**
+     * @brief An API to create PEL through the PEL queue.
+     *
+     * This API queues the PEL and returns without waiting for the bus. A
+     * dispatcher thread makes synchronous call to phosphor-logging Create
+     * method for queued PELs, in the order they are queued.
+     * A PEL identical in error type, severity, user data and description to a
+     * PEL created in the last PEL_DEDUP_WINDOW_SEC is merged into it. A PEL is
+     * dropped if PEL_QUEUE_SIZE PELs are already waiting.
+     *
+     * @param[in] i_errorType - Enum to map with event message name.
+     * @param[in] i_severity - Severity of the event.
+     * @param[in] i_fileName - File name.
+     * @param[in] i_funcName - Function name.
+     * @param[in] i_internalRc - Internal return code.
+     * @param[in] i_description - Error description.
+     * @param[in] i_userData1 - Additional user data [optional].
+     * @param[in] i_userData2 - Additional user data [optional].
+     * @param[in] i_symFru - Symblolic FRU callout data [optional].s
+     * @param[in] i_procedure - Procedure callout data [optional].
+     *
+     * @todo: Symbolic FRU and procedure callout needs to be handled in this
+     * API.
+     */
+    static void createQueuedPel(
+        const types::ErrorType& i_errorType,
+        const types::SeverityType& i_severity, const std::string& i_fileName,
+        const std::string& i_funcName, const uint8_t i_internalRc,
+        const std::string& i_description,
+        const std::optional<std::string> i_userData1,
+        const std::optional<std::string> i_userData2,
+        const std::optional<std::string> i_symFru,
+        const std::optional<std::string> i_procedure);
+
   private:
+    // PEL waiting to be created.
+    struct PelRequest;
+
+    // Queue of PELs waiting to be created.
+    class PelQueue;
+
+    /**
+     * @brief API to get queue of PELs waiting to be created.
+     *
+     * The queue and its dispatcher thread are created on first use.
+     *
+     * @return PEL queue.
+     */
+    static PelQueue& getPelQueue();
+
+    /**
+     * @brief API to build a PEL request.
+     *
+     * @param[in] i_errorType - Enum to map with event message name.
+     * @param[in] i_severity - Severity of the event.
+     * @param[in] i_fileName - File name.
+     * @param[in] i_funcName - Function name.
+     * @param[in] i_internalRc - Internal return code.
+     * @param[in] i_description - Error description.
+     * @param[in] i_userData1 - Additional user data [optional].
+     * @param[in] i_userData2 - Additional user data [optional].
+     *
+     * @throw std::runtime_error if error type is not supported.
+     *
+     * @return PEL request.
+     */
+    static PelRequest makePelRequest(
+        const types::ErrorType& i_errorType,
+        const types::SeverityType& i_severity, const std::string& i_fileName,
+        const std::string& i_funcName, const uint8_t i_internalRc,
+        const std::string& i_description,
+        const std::optional<std::string>& i_userData1,
+        const std::optional<std::string>& i_userData2);
+
+    /**
+     * @brief API to create a PEL.
+     *
+     * This API makes synchronous call to phosphor-logging Create method.
+     *
+     * @param[in] i_request - PEL to be created.
+     */
+    static void createPel(const PelRequest& i_request);
+
     /**
      * @brief API to get error info based on the exception.
      *
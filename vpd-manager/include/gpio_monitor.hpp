@@ -1,12 +1,18 @@
 #pragma once
 
+#include "constants.hpp"
+#include "debouncer.hpp"
 #include "event_logger.hpp"
 #include "worker.hpp"
 
+#include <boost/asio/posix/stream_descriptor.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <gpiod.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/asio/connection.hpp>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace vpd
@@ -18,6 +24,9 @@ namespace vpd
  * monitors the presence of the FRU. If it detects any change, performs
  * deletion of FRU VPD if FRU is not present, otherwise performs VPD
  * collection if FRU gets added.
+ *
+ * Presence line is requested for edge events which are waited upon in the io
+ * context, the line is polled only if edge events are not available.
  */
 class GpioEventHandler
 {
@@ -39,7 +48,10 @@ class GpioEventHandler
     GpioEventHandler(
         const std::string i_fruPath, const std::shared_ptr<Worker>& i_worker,
         const std::shared_ptr<boost::asio::io_context>& i_ioContext) :
-        m_fruPath(i_fruPath), m_worker(i_worker)
+        m_fruPath(i_fruPath), m_worker(i_worker),
+        m_debouncer(*i_ioContext,
+                    std::chrono::milliseconds(
+                        constants::GPIO_PRESENCE_DEBOUNCE_TIME_MS))
     {
         setEventHandlerForGpioPresence(i_ioContext);
     }
@@ -59,14 +71,50 @@ class GpioEventHandler
     /**
      * @brief An API to set event handler for FRUs GPIO presence.
      *
-     * An API to set timer to call event handler to detect GPIO presence
-     * of the FRU.
+     * An API to set edge event handler to detect GPIO presence of the FRU.
+     * If edge events are not available, a timer is set to poll the presence.
      *
      * @param[in] i_ioContext - pointer to io context object
      */
     void setEventHandlerForGpioPresence(
         const std::shared_ptr<boost::asio::io_context>& i_ioContext);
 
+    /**
+     * @brief An API to set edge event handler for FRUs GPIO presence.
+     *
+     * The API requests the presence line for both edge events and waits for
+     * them on the line's file descriptor in the io context.
+     *
+     * @param[in] i_ioContext - pointer to io context object
+     *
+     * @throw std::exception if edge events could not be set up.
+     */
+    void setEdgeEventHandlerForGpioPresence(
+        const std::shared_ptr<boost::asio::io_context>& i_ioContext);
+
+    /**
+     * @brief API to wait for next edge event on the presence line.
+     */
+    void waitForEdgeEvent();
+
+    /**
+     * @brief API to handle edge event on the presence line.
+     *
+     * This API consumes pending events and (re)starts the quiet period, the
+     * presence is read once the line is stable.
+     *
+     * @param[in] i_errorCode - Error Code
+     */
+    void handleEdgeEvent(const boost::system::error_code& i_errorCode);
+
+    /**
+     * @brief API to handle end of the quiet period after edge events.
+     *
+     * This API reads the presence and takes action if there is any change in
+     * the GPIO presence value.
+     */
+    void handleSettledPresence();
+
     /**
      * @brief API to handle timer expiry.
      *
@@ -86,6 +134,17 @@ class GpioEventHandler
 
     // Preserves the GPIO pin value to compare. Default value is false.
     bool m_prevPresencePinValue = false;
+
+    // Presence line and its value when FRU is present.
+    std::string m_presencePinName;
+    int m_presencePinValue = 0;
+    gpiod::line m_presenceLine;
+
+    // Descriptor to wait for edge events of the presence line.
+    std::unique_ptr<boost::asio::posix::stream_descriptor> m_eventDescriptor;
+
+    // Debounces edge events of the presence line.
+    Debouncer m_debouncer;
 };
 
 class GpioMonitor
@@ -105,12 +164,13 @@ class GpioMonitor
      * @param[in] i_worker - pointer to the worker object.
      * @param[in] i_ioContext - pointer to IO context object.
      */
-    GpioMonitor(const nlohmann::json i_sysCfgJsonObj,
-                const std::shared_ptr<Worker>& i_worker,
-                const std::shared_ptr<boost::asio::io_context>& i_ioContext) :
+    GpioMonitor(
+        const std::shared_ptr<const nlohmann::json>& i_sysCfgJsonObj,
+        const std::shared_ptr<Worker>& i_worker,
+        const std::shared_ptr<boost::asio::io_context>& i_ioContext) :
         m_sysCfgJsonObj(i_sysCfgJsonObj)
     {
-        if (!m_sysCfgJsonObj.empty())
+        if (m_sysCfgJsonObj && !m_sysCfgJsonObj->empty())
         {
             initHandlerForGpio(i_ioContext, i_worker);
         }
@@ -141,6 +201,7 @@ class GpioMonitor
     // Array of event handlers for all the attachable FRUs.
     std::vector<std::shared_ptr<GpioEventHandler>> m_gpioEventHandlerObjects;
 
-    const nlohmann::json& m_sysCfgJsonObj;
+    // Snapshot of system config JSON.
+    std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj;
 };
 } // namespace vpd
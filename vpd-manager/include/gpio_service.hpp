@@ -0,0 +1,326 @@
+#pragma once
+
+#include "exceptions.hpp"
+
+#include <gpiod.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to access GPIO lines.
+ *
+ * A line can be requested only once at a time. Lines requested for edge events
+ * stay requested for lifetime of the object, hence any read of such a line has
+ * to be served from the same request, which this class takes care of.
+ * Lines set as output also stay requested, so that they keep being driven to
+ * the value set, on some controllers a released line goes back to its default
+ * state. Lines requested to read are released right after, so that they are
+ * free for other consumers.
+ *
+ * Line names are resolved to their chip and offset once, so that repeated
+ * access to a line doesn't need a scan of all the chips.
+ *
+ * All APIs are thread safe.
+ */
+class GpioService
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    GpioService(const GpioService&) = delete;
+    GpioService& operator=(const GpioService&) = delete;
+    GpioService(GpioService&&) = delete;
+    GpioService& operator=(GpioService&&) = delete;
+
+    /**
+     * @brief Constructor.
+     */
+    GpioService() = default;
+
+    /**
+     * @brief Destructor, releases the lines which stay requested.
+     */
+    ~GpioService()
+    {
+        for (auto* l_lines : {&m_eventLines, &m_outputLines})
+        {
+            for (auto& [l_lineName, l_line] : *l_lines)
+            {
+                try
+                {
+                    l_line.release();
+                }
+                catch (const std::exception&)
+                {
+                    // Line goes with its chip anyway.
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief API to request a line for both edge events.
+     *
+     * The line stays requested for lifetime of the object.
+     *
+     * @param[in] i_lineName - Name of the line.
+     * @param[in] i_consumer - Consumer of the line.
+     *
+     * @throw GpioException if the line could not be requested.
+     *
+     * @return Requested line.
+     */
+    gpiod::line requestEdgeEvents(const std::string& i_lineName,
+                                  const std::string& i_consumer)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        if (m_eventLines.contains(i_lineName) ||
+            m_outputLines.contains(i_lineName))
+        {
+            throw GpioException(
+                "GPIO line [" + i_lineName + "] is already requested.");
+        }
+
+        gpiod::line l_line = resolveLine(i_lineName);
+        l_line.request(
+            {i_consumer, gpiod::line_request::EVENT_BOTH_EDGES, 0});
+
+        m_eventLines.emplace(i_lineName, l_line);
+        return l_line;
+    }
+
+    /**
+     * @brief API to read value of a line.
+     *
+     * Value is read from the edge event or output request of the line if any,
+     * else the line is requested as input and released once read.
+     *
+     * @param[in] i_lineName - Name of the line.
+     * @param[in] i_consumer - Consumer of the line.
+     *
+     * @throw GpioException if the line could not be found, other exceptions
+     * from libgpiod if the line could not be requested or read.
+     *
+     * @return Value of the line.
+     */
+    int getValue(const std::string& i_lineName, const std::string& i_consumer)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        const auto l_itrToLine = m_eventLines.find(i_lineName);
+        if (l_itrToLine != m_eventLines.end())
+        {
+            return l_itrToLine->second.get_value();
+        }
+
+        const auto l_itrToOutputLine = m_outputLines.find(i_lineName);
+        if (l_itrToOutputLine != m_outputLines.end())
+        {
+            return l_itrToOutputLine->second.get_value();
+        }
+
+        gpiod::line l_line = resolveLine(i_lineName);
+        l_line.request(
+            {i_consumer, gpiod::line_request::DIRECTION_INPUT, 0});
+
+        const int l_value = l_line.get_value();
+        l_line.release();
+        return l_value;
+    }
+
+    /**
+     * @brief API to read values of multiple lines.
+     *
+     * Lines are requested as input with a single request per chip, read
+     * together and released. Lines requested for edge events or as output are
+     * read from their existing request.
+     *
+     * Lines which could not be found, requested or read are left out of the
+     * result, caller can read them individually to get the error.
+     *
+     * @param[in] i_lineNames - Names of the lines.
+     * @param[in] i_consumer - Consumer of the lines.
+     *
+     * @return Map of line name to its value.
+     */
+    std::unordered_map<std::string, int> getValues(
+        const std::vector<std::string>& i_lineNames,
+        const std::string& i_consumer) noexcept
+    {
+        std::unordered_map<std::string, int> l_values;
+
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        // Chip name to lines of the chip yet to be requested.
+        std::unordered_map<std::string,
+                           std::vector<std::pair<std::string, gpiod::line>>>
+            l_linesPerChip;
+
+        for (const auto& l_lineName : i_lineNames)
+        {
+            if (l_values.contains(l_lineName))
+            {
+                continue;
+            }
+
+            try
+            {
+                const auto l_itrToLine = m_eventLines.find(l_lineName);
+                if (l_itrToLine != m_eventLines.end())
+                {
+                    l_values.emplace(l_lineName,
+                                     l_itrToLine->second.get_value());
+                    continue;
+                }
+
+                const auto l_itrToOutputLine = m_outputLines.find(l_lineName);
+                if (l_itrToOutputLine != m_outputLines.end())
+                {
+                    l_values.emplace(l_lineName,
+                                     l_itrToOutputLine->second.get_value());
+                    continue;
+                }
+
+                gpiod::line l_line = resolveLine(l_lineName);
+                auto& l_chipLines = l_linesPerChip[l_line.get_chip().name()];
+
+                const bool l_isListed = std::ranges::any_of(
+                    l_chipLines, [&l_lineName](const auto& l_chipLine) {
+                        return l_chipLine.first == l_lineName;
+                    });
+
+                if (!l_isListed)
+                {
+                    l_chipLines.emplace_back(l_lineName, l_line);
+                }
+            }
+            catch (const std::exception&)
+            {
+                // Left for the caller to read individually.
+            }
+        }
+
+        for (const auto& [l_chipName, l_chipLines] : l_linesPerChip)
+        {
+            try
+            {
+                gpiod::line_bulk l_bulk;
+                for (const auto& l_chipLine : l_chipLines)
+                {
+                    l_bulk.append(l_chipLine.second);
+                }
+
+                l_bulk.request(
+                    {i_consumer, gpiod::line_request::DIRECTION_INPUT, 0});
+
+                const std::vector<int> l_bulkValues = l_bulk.get_values();
+                l_bulk.release();
+
+                for (size_t l_index = 0; l_index < l_chipLines.size();
+                     ++l_index)
+                {
+                    l_values.emplace(l_chipLines[l_index].first,
+                                     l_bulkValues.at(l_index));
+                }
+            }
+            catch (const std::exception&)
+            {
+                // Left for the caller to read individually.
+            }
+        }
+
+        return l_values;
+    }
+
+    /**
+     * @brief API to set value of a line.
+     *
+     * The line is requested as output with the value on first call and stays
+     * requested, so that it keeps being driven. Later calls only update the
+     * value.
+     *
+     * @param[in] i_lineName - Name of the line.
+     * @param[in] i_consumer - Consumer of the line.
+     * @param[in] i_value - Value to set.
+     *
+     * @throw GpioException if the line could not be found or is requested for
+     * edge events, other exceptions from libgpiod if the line could not be
+     * requested or set.
+     */
+    void setValue(const std::string& i_lineName, const std::string& i_consumer,
+                  const int i_value)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        if (m_eventLines.contains(i_lineName))
+        {
+            throw GpioException("GPIO line [" + i_lineName +
+                                "] is requested for edge events.");
+        }
+
+        const auto l_itrToLine = m_outputLines.find(i_lineName);
+        if (l_itrToLine != m_outputLines.end())
+        {
+            l_itrToLine->second.set_value(i_value);
+            return;
+        }
+
+        gpiod::line l_line = resolveLine(i_lineName);
+        l_line.request(
+            {i_consumer, gpiod::line_request::DIRECTION_OUTPUT, 0}, i_value);
+
+        m_outputLines.emplace(i_lineName, l_line);
+    }
+
+  private:
+    /**
+     * @brief API to resolve a line name to the line on its chip.
+     *
+     * Caller should hold m_mutex.
+     *
+     * @param[in] i_lineName - Name of the line.
+     *
+     * @throw GpioException if the line could not be found.
+     *
+     * @return Line.
+     */
+    gpiod::line resolveLine(const std::string& i_lineName)
+    {
+        const auto l_itrToLine = m_resolvedLines.find(i_lineName);
+        if (l_itrToLine != m_resolvedLines.end())
+        {
+            return l_itrToLine->second;
+        }
+
+        gpiod::line l_line = gpiod::find_line(i_lineName);
+        if (!l_line)
+        {
+            throw GpioException("Couldn't find the GPIO line.");
+        }
+
+        m_resolvedLines.emplace(i_lineName, l_line);
+        return l_line;
+    }
+
+    // Mutex to guard the members below.
+    std::mutex m_mutex;
+
+    // Line name to line, which holds its chip open.
+    std::unordered_map<std::string, gpiod::line> m_resolvedLines;
+
+    // Line name to line requested for edge events.
+    std::unordered_map<std::string, gpiod::line> m_eventLines;
+
+    // Line name to line requested as output.
+    std::unordered_map<std::string, gpiod::line> m_outputLines;
+};
+} // namespace vpd
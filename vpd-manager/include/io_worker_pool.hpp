@@ -0,0 +1,87 @@
+#pragma once
+
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class for a pool of threads to run tasks accessing hardware.
+ *
+ * Tasks on an EEPROM are kept in order by running them on a strand of the
+ * pool. Strand is picked from a fixed set by hash of the EEPROM path, so that
+ * the number of strands doesn't grow with paths passed by callers. Tasks on
+ * EEPROMs sharing a strand are serialised as well.
+ *
+ * Destroying the pool stops it and joins its threads.
+ */
+class IoWorkerPool
+{
+  public:
+    // Strand of the pool.
+    using Strand = boost::asio::strand<boost::asio::thread_pool::executor_type>;
+
+    /**
+     * List of deleted functions.
+     */
+    IoWorkerPool(const IoWorkerPool&) = delete;
+    IoWorkerPool& operator=(const IoWorkerPool&) = delete;
+    IoWorkerPool(IoWorkerPool&&) = delete;
+    IoWorkerPool& operator=(IoWorkerPool&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_threadCount - Number of threads in the pool.
+     * @param[in] i_strandCount - Number of strands to order EEPROM tasks, at
+     * least one is created.
+     */
+    IoWorkerPool(size_t i_threadCount, size_t i_strandCount) :
+        m_threadPool(i_threadCount)
+    {
+        const size_t l_strandCount = std::max<size_t>(i_strandCount, 1);
+
+        m_strands.reserve(l_strandCount);
+        for (size_t l_index = 0; l_index < l_strandCount; ++l_index)
+        {
+            m_strands.push_back(boost::asio::make_strand(m_threadPool));
+        }
+    }
+
+    /**
+     * @brief API to get executor for tasks which need no ordering.
+     *
+     * @return Executor of the pool.
+     */
+    boost::asio::thread_pool::executor_type getExecutor()
+    {
+        return m_threadPool.get_executor();
+    }
+
+    /**
+     * @brief API to get strand which serialises tasks on an EEPROM.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @return Strand of the EEPROM.
+     */
+    Strand& getStrand(const std::string& i_eepromPath)
+    {
+        return m_strands[std::hash<std::string>{}(i_eepromPath) %
+                         m_strands.size()];
+    }
+
+  private:
+    // Threads running the tasks.
+    boost::asio::thread_pool m_threadPool;
+
+    // Strands to keep tasks on an EEPROM in order, indexed by path hash.
+    std::vector<Strand> m_strands;
+};
+} // namespace vpd
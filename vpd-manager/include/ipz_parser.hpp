@@ -106,6 +106,21 @@ class IpzVpdParser : public ParserInterface
      */
     int writeKeywordOnHardware(const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief API to write multiple keywords' value on hardware.
+     *
+     * All the keywords are updated on a single copy of the VPD, ECC of each
+     * updated record is computed and written once after all its keywords are
+     * set.
+     *
+     * @param[in] i_paramsToWriteData - List of data required to perform write.
+     *
+     * @return Result of each write, in the order of the given list. Failed
+     * writes hold the exception thrown for them.
+     */
+    std::vector<types::WriteResult> writeKeywordsOnHardware(
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData) override;
+
   private:
     /**
      * @brief Check ECC of VPD header.
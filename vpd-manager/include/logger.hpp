@@ -1,6 +1,8 @@
 #pragma once
 
-#include <iostream>
+#include "config.h"
+
+#include <cstdint>
 #include <source_location>
 #include <string_view>
 
@@ -11,16 +13,82 @@ namespace vpd
  */
 namespace logging
 {
+/**
+ * @brief Level of a log message.
+ *
+ * Values are the journal priorities the levels are logged with.
+ */
+enum class LogLevel : uint8_t
+{
+    Error = 3,
+    Warning = 4,
+    Info = 6,
+    Debug = 7
+};
+
+// Messages with a level above this are compiled out.
+static constexpr LogLevel MAX_LOG_LEVEL =
+    static_cast<LogLevel>(VPD_MAX_LOG_LEVEL);
+
+/**
+ * @brief Function to write a log message out, in place of journal.
+ *
+ * Arguments are level, message, file name, line and function name.
+ */
+using LogSink = void (*)(LogLevel, std::string_view, const char*, uint32_t,
+                         const char*);
+
+/**
+ * @brief An api to set where log messages are written.
+ *
+ * Messages are written to journal by default, a sink is used by tests to
+ * capture them.
+ *
+ * @param[in] i_sink - Sink to write messages to, nullptr for journal.
+ */
+void setLogSink(LogSink i_sink) noexcept;
+
+/**
+ * @brief An api to queue a message to be logged to journal.
+ *
+ * The message is copied to the calling thread's log buffer and written to
+ * journal by a background thread, so the API doesn't block on journal.
+ * Message longer than LOG_MESSAGE_MAX_SIZE is written to journal directly.
+ * If the buffer is full, warnings and errors are written to journal directly
+ * and other messages are dropped, count of dropped messages is logged in their
+ * place.
+ *
+ * @param[in] i_level - Level of the message.
+ * @param[in] i_message - Information that we want to log.
+ * @param[in] i_location - Object of source_location class.
+ */
+void queueMessage(LogLevel i_level, std::string_view i_message,
+                  const std::source_location& i_location) noexcept;
 
 /**
  * @brief An api to log message.
  * This API should be called to log message. It will auto append information
  * like file name, line and function name to the message being logged.
  *
+ * @tparam Level - Level of the message, Info by default.
+ *
  * @param[in] message - Information that we want  to log.
  * @param[in] location - Object of source_location class.
  */
-void logMessage(std::string_view message, const std::source_location& location =
-                                              std::source_location::current());
+template <LogLevel Level = LogLevel::Info>
+inline void logMessage(std::string_view message,
+                       const std::source_location& location =
+                           std::source_location::current())
+{
+    if constexpr (Level <= MAX_LOG_LEVEL)
+    {
+        queueMessage(Level, message, location);
+    }
+    else
+    {
+        (void)message;
+        (void)location;
+    }
+}
 } // namespace logging
 } // namespace vpd
@@ -3,12 +3,23 @@
 #include "backup_restore.hpp"
 #include "constants.hpp"
 #include "gpio_monitor.hpp"
+#include "io_worker_pool.hpp"
+#include "pinned_keyword.hpp"
+#include "system_state_cache.hpp"
 #include "types.hpp"
 #include "worker.hpp"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/spawn.hpp>
 #include <oem-handler/ibm_handler.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
+#include <exception>
+#include <future>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 namespace vpd
 {
 /**
@@ -65,6 +76,27 @@ class Manager
     int updateKeyword(const types::Path i_vpdPath,
                       const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief Update multiple keyword values of a FRU.
+     *
+     * This API is used to update keyword values on the given input path and
+     * its redundant path(s) if any taken from system config JSON. All the
+     * keywords are written in one batch and published to D-Bus with a single
+     * call, which is cheaper than calling updateKeyword for each of them.
+     *
+     * Each keyword succeeds or fails on its own. Backup is updated for every
+     * keyword which got updated, even if others in the list failed.
+     *
+     * @param[in] i_vpdPath - Path (inventory object path/FRU EEPROM path).
+     * @param[in] i_paramsToWriteData - List of input details.
+     *
+     * @return Result of each update in the order of the given list. On success
+     * number of bytes written, on failure -1.
+     */
+    std::vector<int> updateKeywords(
+        const types::Path& i_vpdPath,
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -113,12 +145,57 @@ class Manager
         const types::Path i_fruPath,
         const types::ReadVpdParams i_paramsToReadData);
 
+    /**
+     * @brief Read multiple keywords' value.
+     *
+     * API reads the EEPROM once and serves all the requested IPZ keywords from
+     * it. Eg: [("VINI", "SN"), ("VINI", "PN")].
+     *
+     * Each keyword is reported against "Record:Keyword" along with an error
+     * code, 0 on success, EINVAL if the keyword can't be read through this
+     * API, EIO for any other failure. Value is empty for failed keywords.
+     *
+     * @param[in] i_fruPath - EEPROM path.
+     * @param[in] i_keywordsToRead - List of record and keyword to read.
+     *
+     * @throw
+     * sdbusplus::xyz::openbmc_project::Common::Device::Error::ReadFailure if
+     * EEPROM can't be read.
+     *
+     * @return Map of "Record:Keyword" to error code and value read.
+     */
+    types::ReadKeywordsResult readKeywords(
+        const types::Path i_fruPath,
+        const std::vector<types::IpzType> i_keywordsToRead);
+
+    /**
+     * @brief Get complete parsed VPD of a FRU.
+     *
+     * API returns all records and keywords of the FRU in one go. VPD parsed
+     * during collection is returned, unless it is not available or a read
+     * from hardware is requested.
+     *
+     * @param[in] i_vpdPath - EEPROM path or inventory path of the FRU.
+     * @param[in] i_readFromHardware - true to parse VPD from hardware.
+     *
+     * @throw
+     * sdbusplus::xyz::openbmc_project::Common::Device::Error::ReadFailure if
+     * VPD can't be parsed.
+     *
+     * @return Map of record to keyword and value for IPZ VPD, map of keyword
+     * to value for keyword and DDIMM VPD.
+     */
+    types::FruVpdMap getFruVpd(const types::Path i_vpdPath,
+                               const bool i_readFromHardware);
+
     /**
      * @brief Collect single FRU VPD
      * API can be used to perform VPD collection for the given FRU, only if the
      * current state of the system matches with the state at which the FRU is
      * allowed for VPD recollection.
      *
+     * Caller has to make sure that VPD collection of the system is completed.
+     *
      * @param[in] i_dbusObjPath - D-bus object path
      */
     void collectSingleFruVpd(
@@ -219,6 +296,35 @@ class Manager
     std::tuple<std::string, uint16_t> getUnexpandedLocationCode(
         const std::string& i_expandedLocationCode);
 
+    /**
+     * @brief API to run a task in order with D-Bus method tasks on an EEPROM.
+     *
+     * For callers outside the I/O worker pool which access an EEPROM, like
+     * BIOS attribute sync, so that their access is not interleaved with D-Bus
+     * method tasks on the same EEPROM. Caller is blocked till the task is run.
+     * Must not be called from a task on the I/O worker pool.
+     *
+     * @param[in] i_vpdPath - Inventory path/FRU EEPROM path the task operates
+     * on.
+     * @param[in] i_task - Task to run.
+     *
+     * @throw Exception thrown by the task.
+     *
+     * @return Value returned by the task.
+     */
+    template <typename Task>
+    std::invoke_result_t<Task> runOnEepromStrand(const types::Path& i_vpdPath,
+                                                 Task&& i_task)
+    {
+        std::packaged_task<std::invoke_result_t<Task>()> l_task(
+            std::forward<Task>(i_task));
+        auto l_result = l_task.get_future();
+
+        boost::asio::post(m_ioWorkerPool.getStrand(getEepromPath(i_vpdPath)),
+                          std::move(l_task));
+        return l_result.get();
+    }
+
   private:
     /**
      * @brief An api to check validity of unexpanded location code.
@@ -229,6 +335,90 @@ class Manager
      */
     bool isValidUnexpandedLocationCode(const std::string& i_locationCode);
 
+    /**
+     * @brief API to get EEPROM path of a FRU.
+     *
+     * @param[in] i_vpdPath - Inventory path/FRU EEPROM path.
+     *
+     * @return EEPROM path from system config JSON if found, given path
+     * otherwise.
+     */
+    types::Path getEepromPath(const types::Path& i_vpdPath) const;
+
+    /**
+     * @brief API to run a D-Bus method task on the I/O worker pool.
+     *
+     * The calling coroutine is suspended till the task completes, event loop
+     * keeps serving other requests and timers meanwhile. Tasks on the same
+     * EEPROM are run in the order they were received.
+     *
+     * @param[in] i_yield - Coroutine context of the D-Bus method.
+     * @param[in] i_vpdPath - Inventory path/FRU EEPROM path the task operates
+     * on, empty if the task needs no ordering.
+     * @param[in] i_task - Task to run.
+     *
+     * @throw Exception thrown by the task.
+     *
+     * @return Value returned by the task.
+     */
+    template <typename Task>
+    std::invoke_result_t<Task> runOnIoPool(boost::asio::yield_context i_yield,
+                                           const types::Path& i_vpdPath,
+                                           Task&& i_task)
+    {
+        using Outcome =
+            std::tuple<std::exception_ptr, std::invoke_result_t<Task>>;
+
+        auto l_initiation = [this, &i_vpdPath](auto i_handler,
+                                                  auto i_taskToRun) {
+            auto l_job = [l_handler = std::move(i_handler),
+                          l_task = std::move(i_taskToRun)]() mutable {
+                Outcome l_outcome;
+                try
+                {
+                    std::get<1>(l_outcome) = l_task();
+                }
+                catch (...)
+                {
+                    std::get<0>(l_outcome) = std::current_exception();
+                }
+
+                // Resume the coroutine on the event loop.
+                auto l_executor =
+                    boost::asio::get_associated_executor(l_handler);
+                boost::asio::post(
+                    l_executor, [l_handler = std::move(l_handler),
+                                 l_outcome = std::move(l_outcome)]() mutable {
+                        l_handler(std::move(l_outcome));
+                    });
+            };
+
+            if (i_vpdPath.empty())
+            {
+                boost::asio::post(m_ioWorkerPool.getExecutor(),
+                                  std::move(l_job));
+            }
+            else
+            {
+                boost::asio::post(
+                    m_ioWorkerPool.getStrand(getEepromPath(i_vpdPath)),
+                    std::move(l_job));
+            }
+        };
+
+        Outcome l_outcome =
+            boost::asio::async_initiate<boost::asio::yield_context,
+                                        void(Outcome)>(
+                l_initiation, i_yield, std::forward<Task>(i_task));
+
+        if (std::get<0>(l_outcome))
+        {
+            std::rethrow_exception(std::get<0>(l_outcome));
+        }
+
+        return std::move(std::get<1>(l_outcome));
+    }
+
     // Shared pointer to asio context object.
     const std::shared_ptr<boost::asio::io_context>& m_ioContext;
 
@@ -252,6 +442,22 @@ class Manager
 
     // Shared pointer to oem specific class.
     std::shared_ptr<IbmHandler> m_ibmHandler;
+
+    // Locations of keywords read directly from hardware.
+    PinnedKeyword m_pinnedKeyword;
+
+    // U-Boot environment, shared with the worker.
+    std::shared_ptr<UBootEnv> m_uBootEnv = std::make_shared<UBootEnv>();
+
+    // Chassis, host and BMC state, kept up to date for the life of the
+    // service and shared with the worker.
+    std::shared_ptr<SystemStateCache> m_systemStateCache =
+        std::make_shared<SystemStateCache>();
+
+    // Pool to run D-Bus method tasks accessing hardware. Declared last so that
+    // pending tasks are joined before other members are destroyed.
+    IoWorkerPool m_ioWorkerPool{constants::IO_WORKER_POOL_SIZE,
+                                constants::EEPROM_STRAND_COUNT};
 };
 
 } // namespace vpd
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+namespace vpd
+{
+/**
+ * @brief Class to cache parsed VPD of EEPROMs.
+ *
+ * VPD parsed to serve a read is cached against the EEPROM path till the
+ * EEPROM is written to, recollected or the FRU is deleted, which invalidates
+ * it. A limited number of EEPROMs are cached, the one cached first is dropped
+ * to make room.
+ *
+ * Every invalidation of an EEPROM bumps its generation. Callers read the
+ * generation before parsing, and parsed VPD is cached only if the generation
+ * is unchanged, so that VPD parsed while the EEPROM is written to is not
+ * cached.
+ *
+ * All APIs are thread safe.
+ */
+class ParsedVpdCache
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    ParsedVpdCache(const ParsedVpdCache&) = delete;
+    ParsedVpdCache& operator=(const ParsedVpdCache&) = delete;
+    ParsedVpdCache(ParsedVpdCache&&) = delete;
+    ParsedVpdCache& operator=(ParsedVpdCache&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_maxEntries - Max number of EEPROMs to cache.
+     */
+    explicit ParsedVpdCache(
+        size_t i_maxEntries = constants::MAX_PARSED_VPD_CACHE_ENTRIES) :
+        m_maxEntries(i_maxEntries)
+    {}
+
+    /**
+     * @brief API to get parsed VPD of an EEPROM.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Parsed VPD if cached, std::nullopt otherwise.
+     */
+    std::optional<types::VPDMapVariant> get(
+        const std::string& i_vpdFilePath) const
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        if (auto l_itr = m_entries.find(i_vpdFilePath);
+            l_itr != m_entries.end())
+        {
+            return l_itr->second;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief API to get generation of an EEPROM.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Generation of the EEPROM.
+     */
+    uint64_t getGeneration(const std::string& i_vpdFilePath) const
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        if (auto l_itr = m_generations.find(i_vpdFilePath);
+            l_itr != m_generations.end())
+        {
+            return l_itr->second;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief API to cache parsed VPD of an EEPROM.
+     *
+     * VPD is not cached if it is empty, or if the EEPROM has been invalidated
+     * since the given generation was read.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_parsedVpd - Parsed VPD of the EEPROM.
+     * @param[in] i_generation - Generation of the EEPROM read before parsing.
+     */
+    void put(const std::string& i_vpdFilePath,
+             const types::VPDMapVariant& i_parsedVpd, uint64_t i_generation)
+    {
+        if (m_maxEntries == 0 ||
+            std::holds_alternative<std::monostate>(i_parsedVpd))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+
+        // Invalidated while being parsed, VPD may be stale.
+        if (auto l_itr = m_generations.find(i_vpdFilePath);
+            l_itr != m_generations.end() && l_itr->second != i_generation)
+        {
+            return;
+        }
+
+        if (!m_entries.insert_or_assign(i_vpdFilePath, i_parsedVpd).second)
+        {
+            return;
+        }
+
+        m_order.push_back(i_vpdFilePath);
+        if (m_order.size() > m_maxEntries)
+        {
+            m_entries.erase(m_order.front());
+            m_order.pop_front();
+        }
+    }
+
+    /**
+     * @brief API to invalidate parsed VPD of an EEPROM.
+     *
+     * Needs to be called whenever VPD of the EEPROM is updated or removed.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     */
+    void invalidate(const std::string& i_vpdFilePath)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        ++m_generations[i_vpdFilePath];
+
+        if (m_entries.erase(i_vpdFilePath))
+        {
+            std::erase(m_order, i_vpdFilePath);
+        }
+    }
+
+  private:
+    // Max number of EEPROMs to cache.
+    const size_t m_maxEntries;
+
+    // Parsed VPD against EEPROM path.
+    std::unordered_map<std::string, types::VPDMapVariant> m_entries;
+
+    // EEPROM paths in m_entries, in the order they were cached.
+    std::deque<std::string> m_order;
+
+    // EEPROM path to count of times its cached VPD is invalidated.
+    std::unordered_map<std::string, uint64_t> m_generations;
+
+    // Mutex to guard the members above.
+    mutable std::mutex m_mutex;
+};
+} // namespace vpd
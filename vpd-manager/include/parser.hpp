@@ -1,5 +1,6 @@
 #pragma once
 
+#include "eeprom_write_queue.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
 #include "types.hpp"
@@ -9,6 +10,7 @@
 #include <nlohmann/json.hpp>
 
 #include <iostream>
+#include <memory>
 
 namespace vpd
 {
@@ -24,10 +26,28 @@ class Parser
     /**
      * @brief Constructor
      *
+     * JSON is copied, use the constructor taking a shared JSON to avoid it.
+     *
      * @param[in] vpdFilePath - Path to the VPD file.
      * @param[in] parsedJson - Parsed JSON.
+     * @param[in] i_eepromWriteQueue - Queue to write keywords through, null
+     * to write them directly.
+     */
+    Parser(const std::string& vpdFilePath, const nlohmann::json& parsedJson,
+           std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue = nullptr);
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] vpdFilePath - Path to the VPD file.
+     * @param[in] parsedJson - Parsed JSON shared with the caller, null is
+     * taken as empty JSON.
+     * @param[in] i_eepromWriteQueue - Queue to write keywords through, null
+     * to write them directly.
      */
-    Parser(const std::string& vpdFilePath, nlohmann::json parsedJson);
+    Parser(const std::string& vpdFilePath,
+           std::shared_ptr<const nlohmann::json> parsedJson,
+           std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue = nullptr);
 
     /**
      * @brief API to implement a generic parsing logic.
@@ -69,6 +89,25 @@ class Parser
      */
     int updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData);
 
+    /**
+     * @brief Update multiple keywords' value.
+     *
+     * Same as updateVpdKeyword, but all the keywords are written as a single
+     * batch on the EEPROM path and its redundant path, and updated on DBus
+     * with a single call.
+     *
+     * Keywords which fail to update on the EEPROM are reported as failed and
+     * not taken further, rest are updated on the redundant path and DBus. If
+     * either of those fails, all of them are reported as failed.
+     *
+     * @param[in] i_paramsToWriteData - List of input details.
+     *
+     * @return Number of bytes written for each keyword, in the order of the
+     * given list. -1 for the keywords which failed to update.
+     */
+    std::vector<int> updateVpdKeywords(
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -101,26 +140,56 @@ class Parser
      * form of (Keyword, Value). Eg: ("PE", {0x01, 0x02, 0x03}).
      *
      * @param[in] i_fruPath - Redundant EEPROM path.
-     * @param[in] i_paramsToWriteData - Input details.
+     * @param[in] i_paramsToWriteData - List of input details.
      *
-     * @return On success returns number of bytes written, on failure returns
-     * -1.
+     * @return On success returns 0, on failure returns -1.
      */
     int updateVpdKeywordOnRedundantPath(
         const std::string& i_fruPath,
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData);
+
+    /**
+     * @brief Write keyword value on hardware through the EEPROM's write queue.
+     *
+     * Writes to the EEPROM from all the callers sharing the queue are
+     * serialised, and the ones pending together are applied with a single ECC
+     * update per record. Keyword is written directly if there is no queue.
+     *
+     * @param[in] i_paramsToWriteData - Input details.
+     *
+     * @throw Exception thrown by the concrete parser while writing.
+     *
+     * @return Number of bytes written on hardware.
+     */
+    int writeKeywordThroughQueue(
         const types::WriteVpdParams& i_paramsToWriteData);
 
+    /**
+     * @brief Write multiple keywords' value on hardware through the EEPROM's
+     * write queue.
+     *
+     * @param[in] i_paramsToWriteData - List of input details.
+     *
+     * @return Result of each write, in the order of the given list.
+     */
+    std::vector<types::WriteResult> writeKeywordsThroughQueue(
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData);
+
     // holds offfset to VPD if applicable.
     size_t m_vpdStartOffset = 0;
 
     // Path to the VPD file
     const std::string& m_vpdFilePath;
 
-    // Path to configuration file, can be empty.
-    nlohmann::json m_parsedJson;
+    // Path to configuration file, can be empty. Shared, so that it outlives
+    // the parser whatever the caller does with its copy.
+    std::shared_ptr<const nlohmann::json> m_parsedJson;
 
     // Vector to hold VPD.
     types::BinaryVector m_vpdVector;
 
+    // Queue to write keywords through, can be null.
+    std::shared_ptr<EepromWriteQueue> m_eepromWriteQueue;
+
 }; // parser
 } // namespace vpd
@@ -2,7 +2,10 @@
 
 #include "types.hpp"
 
+#include <exception>
+#include <expected>
 #include <variant>
+#include <vector>
 
 namespace vpd
 {
@@ -61,6 +64,39 @@ class ParserInterface
         return -1;
     }
 
+    /**
+     * @brief API to write multiple keywords' value on hardware.
+     *
+     * Derived classes can redefine it to update all the keywords with a single
+     * read of the VPD and a single ECC update per record. By default keywords
+     * are written one after the other.
+     *
+     * @param[in] i_paramsToWriteData - List of data required to perform write.
+     *
+     * @return Result of each write, in the order of the given list.
+     */
+    virtual std::vector<types::WriteResult> writeKeywordsOnHardware(
+        const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+    {
+        std::vector<types::WriteResult> l_results;
+        l_results.reserve(i_paramsToWriteData.size());
+
+        for (const auto& l_paramsToWriteData : i_paramsToWriteData)
+        {
+            try
+            {
+                l_results.emplace_back(
+                    writeKeywordOnHardware(l_paramsToWriteData));
+            }
+            catch (const std::exception&)
+            {
+                l_results.emplace_back(
+                    std::unexpected(std::current_exception()));
+            }
+        }
+        return l_results;
+    }
+
     /**
      * @brief Virtual destructor.
      */
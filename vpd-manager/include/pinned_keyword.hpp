@@ -0,0 +1,140 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vpd
+{
+/**
+ * @brief Class to read single keywords of IPZ VPD without parsing the EEPROM.
+ *
+ * Location of a keyword is found by walking VTOC and the record once, and is
+ * pinned against a fingerprint of VTOC pointer and VTOC ECC. Later reads of
+ * the keyword read only VTOC pointer and ECC, to validate the fingerprint, and
+ * the record holding the keyword with its ECC. As ECC of a record is computed
+ * over the whole record, the whole record is read and ECC checked before the
+ * value is returned. A change in VTOC makes the keyword to be located again.
+ *
+ * All APIs are thread safe.
+ */
+class PinnedKeyword
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    PinnedKeyword(const PinnedKeyword&) = delete;
+    PinnedKeyword& operator=(const PinnedKeyword&) = delete;
+    PinnedKeyword(PinnedKeyword&&) = delete;
+    PinnedKeyword& operator=(PinnedKeyword&&) = delete;
+
+    /**
+     * @brief Constructor.
+     */
+    PinnedKeyword() = default;
+
+    /**
+     * @brief API to read a keyword from hardware.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_recordName - Record name.
+     * @param[in] i_keywordName - Keyword name.
+     * @param[in] i_vpdStartOffset - Offset of VPD in the EEPROM.
+     *
+     * @throw DataException if the record or keyword is not found, EccException
+     * if ECC check of VTOC or the record fails, std::runtime_error if the
+     * EEPROM could not be read.
+     *
+     * @return Value of the keyword.
+     */
+    types::BinaryVector read(const std::string& i_vpdFilePath,
+                             const types::Record& i_recordName,
+                             const types::Keyword& i_keywordName,
+                             size_t i_vpdStartOffset = 0);
+
+  private:
+    /**
+     * @brief Pinned location of a keyword.
+     */
+    struct Location
+    {
+        // Fingerprint of VTOC pointer and VTOC ECC the location was found
+        // with.
+        size_t m_vtocFingerprint = 0;
+
+        types::RecordOffset m_recordOffset = 0;
+        types::RecordLength m_recordLength = 0;
+        types::ECCOffset m_eccOffset = 0;
+        types::ECCLength m_eccLength = 0;
+
+        // Offset of the value w.r.t. start of the record.
+        size_t m_valueOffset = 0;
+        size_t m_valueLength = 0;
+    };
+
+    /**
+     * @brief API to locate a keyword by walking VTOC and the record.
+     *
+     * @param[in] i_fd - File descriptor of the EEPROM.
+     * @param[in] i_vpdFilePath - EEPROM path, for logging.
+     * @param[in] i_vtoc - VTOC record.
+     * @param[in] i_recordName - Record name.
+     * @param[in] i_keywordName - Keyword name.
+     * @param[in] i_vpdStartOffset - Offset of VPD in the EEPROM.
+     *
+     * @throw DataException if the record or keyword is not found.
+     *
+     * @return Location of the keyword, without fingerprint.
+     */
+    static Location locate(int i_fd, const std::string& i_vpdFilePath,
+                           const types::BinaryVector& i_vtoc,
+                           const types::Record& i_recordName,
+                           const types::Keyword& i_keywordName,
+                           size_t i_vpdStartOffset);
+
+    /**
+     * @brief API to read bytes from the EEPROM.
+     *
+     * @param[in] i_fd - File descriptor of the EEPROM.
+     * @param[in] i_offset - Offset to read from.
+     * @param[in] i_length - Number of bytes to read.
+     *
+     * @throw std::runtime_error if the bytes could not be read.
+     *
+     * @return Bytes read.
+     */
+    static types::BinaryVector readBytes(int i_fd, size_t i_offset,
+                                         size_t i_length);
+
+    /**
+     * @brief API to read a block of VPD and check it against its ECC.
+     *
+     * Data and ECC are read with a single read if they are close.
+     *
+     * @param[in] i_fd - File descriptor of the EEPROM.
+     * @param[in] i_vpdFilePath - EEPROM path, for logging.
+     * @param[in] i_dataOffset - Offset of the data.
+     * @param[in] i_dataLength - Length of the data.
+     * @param[in] i_eccOffset - Offset of the ECC.
+     * @param[in] i_eccLength - Length of the ECC.
+     *
+     * @throw EccException if ECC check fails.
+     *
+     * @return Data, corrected if it had a correctable error.
+     */
+    static types::BinaryVector readEccCheckedBlock(
+        int i_fd, const std::string& i_vpdFilePath, size_t i_dataOffset,
+        size_t i_dataLength, size_t i_eccOffset, size_t i_eccLength);
+
+    // Mutex to guard m_locations.
+    std::mutex m_mutex;
+
+    // Pinned locations, by EEPROM path, record and keyword.
+    std::unordered_map<std::string, Location> m_locations;
+};
+} // namespace vpd
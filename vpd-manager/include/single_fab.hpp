@@ -2,6 +2,8 @@
 
 #include "constants.hpp"
 #include "event_logger.hpp"
+#include "pinned_keyword.hpp"
+#include "uboot_env.hpp"
 
 #include <string>
 
@@ -16,6 +18,16 @@ namespace vpd
 class SingleFab
 {
   public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in,out] io_pinnedKeyword - To read IM from the planar.
+     * @param[in,out] io_uBootEnv - To read field mode.
+     */
+    SingleFab(PinnedKeyword& io_pinnedKeyword, UBootEnv& io_uBootEnv) :
+        m_pinnedKeyword(io_pinnedKeyword), m_uBootEnv(io_uBootEnv)
+    {}
+
     /**
      * @brief API to support single FAB feature.
      *
@@ -137,6 +149,12 @@ class SingleFab
         return (isP10System(l_imValue) || isP11System(l_imValue));
     }
 
+    // To read IM from the planar.
+    PinnedKeyword& m_pinnedKeyword;
+
+    // To read field mode.
+    UBootEnv& m_uBootEnv;
+
     // valid IM series.
     static constexpr auto POWER10_IM_SERIES = "5000";
     static constexpr auto POWER11_IM_SERIES = "6000";
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "constants.hpp"
+#include "logger.hpp"
+#include "types.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to cache chassis, host and BMC state.
+ *
+ * Once subscribed, state is read from D-Bus once and kept up to date by
+ * PropertiesChanged signals of the respective state manager objects, so that
+ * the checks can be answered from memory. Until subscribed, or while the state
+ * of a service is not known, the checks fall back to reading D-Bus.
+ *
+ * All APIs are thread safe.
+ */
+class SystemStateCache
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    SystemStateCache(const SystemStateCache&) = delete;
+    SystemStateCache& operator=(const SystemStateCache&) = delete;
+    SystemStateCache(SystemStateCache&&) = delete;
+    SystemStateCache& operator=(SystemStateCache&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * State is read from D-Bus on every check till subscribed.
+     */
+    SystemStateCache() = default;
+
+    /**
+     * @brief API to subscribe to state changes.
+     *
+     * Signals are handled on the IO context of the given connection, till the
+     * object is destroyed. Calling the API again has no effect.
+     *
+     * @param[in] i_asioConnection - Asio connection.
+     */
+    void subscribe(
+        const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection)
+    {
+        if (m_isSubscribed.exchange(true))
+        {
+            return;
+        }
+
+        for (StateProperty* l_state :
+             {&m_chassisPowerState, &m_hostState, &m_bmcState})
+        {
+            // Register before seeding, so that no change is missed in between.
+            m_matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+                *i_asioConnection,
+                sdbusplus::bus::match::rules::propertiesChanged(
+                    l_state->m_objectPath, l_state->m_interface),
+                [l_state](sdbusplus::message_t& l_msg) {
+                    processPropertiesChanged(*l_state, l_msg);
+                }));
+
+            // State is unknown if the service restarts, till read again.
+            m_matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+                *i_asioConnection,
+                sdbusplus::bus::match::rules::nameOwnerChanged(
+                    l_state->m_service),
+                [l_state](sdbusplus::message_t&) {
+                    l_state->m_cachedValue = UNKNOWN;
+                }));
+
+            readState(*l_state);
+        }
+    }
+
+    /**
+     * @brief API to check if chassis is powered on.
+     *
+     * @return true if chassis is powered on, false otherwise.
+     */
+    bool isChassisPowerOn()
+    {
+        return getState(m_chassisPowerState);
+    }
+
+    /**
+     * @brief API to check if host is in running state.
+     *
+     * @return true if host is in running state, false otherwise.
+     */
+    bool isHostRunning()
+    {
+        return getState(m_hostState);
+    }
+
+    /**
+     * @brief API to check if BMC is in ready state.
+     *
+     * @return true if BMC is ready, false otherwise.
+     */
+    bool isBMCReady()
+    {
+        return getState(m_bmcState);
+    }
+
+  private:
+    // Cached value is not known, needs to be read from D-Bus.
+    static constexpr int8_t UNKNOWN = -1;
+
+    /**
+     * @brief A state property and its cached value.
+     */
+    struct StateProperty
+    {
+        const char* m_service;
+        const char* m_objectPath;
+        const char* m_interface;
+        const char* m_property;
+
+        // Property value for which the check holds true.
+        const char* m_expectedValue;
+
+        // UNKNOWN, or 1/0 for whether property holds the expected value.
+        std::atomic<int8_t> m_cachedValue{UNKNOWN};
+    };
+
+    /**
+     * @brief API to get state from cache, reading D-Bus if not known.
+     *
+     * @param[in,out] io_state - State to get.
+     *
+     * @return true if state holds expected value, false otherwise.
+     */
+    bool getState(StateProperty& io_state)
+    {
+        if (const int8_t l_cachedValue = io_state.m_cachedValue;
+            l_cachedValue != UNKNOWN)
+        {
+            return l_cachedValue;
+        }
+
+        return readState(io_state);
+    }
+
+    /**
+     * @brief API to read state from D-Bus.
+     *
+     * Value read is cached only if subscribed and no signal has updated the
+     * cache meanwhile.
+     *
+     * @param[in,out] io_state - State to read.
+     *
+     * @return true if state holds expected value, false otherwise.
+     */
+    bool readState(StateProperty& io_state)
+    {
+        const auto l_value = dbusUtility::readDbusProperty(
+            io_state.m_service, io_state.m_objectPath, io_state.m_interface,
+            io_state.m_property);
+
+        if (const auto l_stateValue = std::get_if<std::string>(&l_value))
+        {
+            const bool l_isExpected =
+                (*l_stateValue == io_state.m_expectedValue);
+
+            if (m_isSubscribed)
+            {
+                int8_t l_unknown = UNKNOWN;
+                io_state.m_cachedValue.compare_exchange_strong(
+                    l_unknown, static_cast<int8_t>(l_isExpected));
+            }
+            return l_isExpected;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief API to update cached state on PropertiesChanged signal.
+     *
+     * @param[in,out] io_state - State to update.
+     * @param[in] i_msg - Callback message.
+     */
+    static void processPropertiesChanged(StateProperty& io_state,
+                                         sdbusplus::message_t& i_msg)
+    {
+        try
+        {
+            std::string l_interface;
+            types::PropertyMap l_propMap;
+            i_msg.read(l_interface, l_propMap);
+
+            const auto l_itrToProperty = l_propMap.find(io_state.m_property);
+            if (l_itrToProperty == l_propMap.end())
+            {
+                return;
+            }
+
+            if (const auto l_stateValue =
+                    std::get_if<std::string>(&l_itrToProperty->second))
+            {
+                io_state.m_cachedValue =
+                    (*l_stateValue == io_state.m_expectedValue);
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            io_state.m_cachedValue = UNKNOWN;
+            logging::logMessage(
+                "Failed to process state change, error: " +
+                std::string(l_ex.what()));
+        }
+    }
+
+    // Set once state change signals are subscribed.
+    std::atomic<bool> m_isSubscribed{false};
+
+    // Chassis power state.
+    StateProperty m_chassisPowerState{
+        constants::chassisStateService, constants::chassisStateObjectPath,
+        constants::chassisStateInterface, constants::currentPowerStateProperty,
+        constants::chassisPowerOnState};
+
+    // Host state.
+    StateProperty m_hostState{
+        constants::hostService, constants::hostObjectPath,
+        constants::hostInterface, "CurrentHostState",
+        constants::hostRunningState};
+
+    // BMC state.
+    StateProperty m_bmcState{
+        constants::bmcStateService, constants::bmcZeroStateObject,
+        constants::bmcStateInterface, constants::currentBMCStateProperty,
+        constants::bmcReadyState};
+
+    // Matches of state change signals. Declared last so that signals stop
+    // before the states they update are destroyed.
+    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> m_matches;
+};
+} // namespace vpd
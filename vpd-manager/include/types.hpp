@@ -6,6 +6,8 @@
 #include <xyz/openbmc_project/Common/Device/error.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 
+#include <exception>
+#include <expected>
 #include <tuple>
 #include <unordered_map>
 #include <variant>
@@ -26,6 +28,7 @@ using BiosBaseTableType = std::map<std::string, BiosBaseTable>;
 using BiosAttributeCurrentValue =
     std::variant<std::monostate, int64_t, std::string>;
 using BiosAttributePendingValue = std::variant<int64_t, std::string>;
+using BiosAttributeValueMap = std::map<std::string, BiosAttributeCurrentValue>;
 using BiosGetAttrRetType = std::tuple<std::string, BiosAttributeCurrentValue,
                                       BiosAttributePendingValue>;
 using PendingBIOSAttrItem =
@@ -132,9 +135,25 @@ using KwData = std::tuple<Keyword, BinaryVector>;
 using VpdData = std::variant<IpzData, KwData>;
 
 using IpzType = std::tuple<Record, Keyword>;
+/* Map<(Record, Keyword), Value> */
+using IpzTypeValueMap = std::map<IpzType, BinaryVector>;
 using ReadVpdParams = std::variant<IpzType, Keyword>;
 using WriteVpdParams = std::variant<IpzData, KwData>;
 
+/* Map of "Record:Keyword" to error code and value read for the keyword. */
+using ReadKeywordsResult =
+    std::map<std::string, std::tuple<int32_t, BinaryVector>>;
+
+/* Parsed VPD of a FRU as published over D-Bus. Map of record to keyword and
+ * value for IPZ format, map of keyword to value for keyword/DDIMM formats. */
+using FruVpdMap =
+    std::variant<std::map<std::string, std::map<std::string, BinaryVector>>,
+                 std::map<std::string, KWdVPDValueType>>;
+
+/* Result of a keyword write, bytes written on success or the exception
+ * thrown. */
+using WriteResult = std::expected<int, std::exception_ptr>;
+
 using ListOfPaths = std::vector<sdbusplus::message::object_path>;
 using RecordData = std::tuple<RecordOffset, RecordLength, ECCOffset, ECCLength>;
 
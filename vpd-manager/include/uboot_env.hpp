@@ -0,0 +1,185 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to read and write U-Boot environment.
+ *
+ * Environment is accessed directly on the storage described by fw_env.config,
+ * instead of running fw_printenv and fw_setenv. In case of redundant
+ * environment, both the copies are validated against their CRC and the active
+ * one is used. A write goes to the inactive copy and switches over to it only
+ * once it is complete, so an interrupted write leaves the old environment in
+ * place.
+ *
+ * A write is atomic only with redundant environment. A single copy is written
+ * in place, after an erase on flash, so a power loss during the write leaves
+ * no valid environment, same as with fw_setenv.
+ *
+ * If no copy is valid, environment is taken as empty, variables read as not
+ * set and the next write creates a valid copy.
+ *
+ * Environment is read once and cached for lifetime of the object, changes
+ * made by other processes afterwards are not seen. For example, "fieldmode"
+ * or "fitconfig" changed with fw_setenv while the object lives still read as
+ * their old value. Hence a single object is meant to be shared by all the
+ * users in a process.
+ *
+ * All APIs are thread safe.
+ */
+class UBootEnv
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    UBootEnv(const UBootEnv&) = delete;
+    UBootEnv& operator=(const UBootEnv&) = delete;
+    UBootEnv(UBootEnv&&) = delete;
+    UBootEnv& operator=(UBootEnv&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * Environment is read on first access.
+     */
+    UBootEnv() = default;
+
+    /**
+     * @brief API to get value of an environment variable.
+     *
+     * @param[in] i_name - Name of the variable.
+     *
+     * @throw std::runtime_error if environment location is not known.
+     *
+     * @return Value of the variable, empty if the variable is not set.
+     */
+    std::string getValue(const std::string& i_name);
+
+    /**
+     * @brief API to set value of an environment variable.
+     *
+     * @param[in] i_name - Name of the variable.
+     * @param[in] i_value - Value to set, empty value deletes the variable.
+     *
+     * @throw std::runtime_error if environment could not be read or written.
+     */
+    void setValue(const std::string& i_name, const std::string& i_value);
+
+    /**
+     * @brief API to compute CRC32 of data, as used by U-Boot.
+     *
+     * @param[in] i_data - Data.
+     *
+     * @return CRC32 of the data.
+     */
+    static uint32_t computeCrc(const types::BinaryVector& i_data) noexcept;
+
+    /**
+     * @brief API to parse variables from data area of an environment copy.
+     *
+     * Data area holds "name=value" strings, terminated by an empty string.
+     * Entries without a '=' are skipped.
+     *
+     * @param[in] i_data - Data area.
+     *
+     * @return Variables in the order they are stored.
+     */
+    static std::vector<std::pair<std::string, std::string>> parseVariables(
+        const types::BinaryVector& i_data);
+
+    /**
+     * @brief API to select the active copy of redundant environment.
+     *
+     * Same as U-Boot, the copy with higher flags is active, taking into
+     * account that incremental flags wrap around from 0xFF to 0. On a tie
+     * the first copy is active.
+     *
+     * @param[in] i_flags0 - Flags of the first copy.
+     * @param[in] i_flags1 - Flags of the second copy.
+     *
+     * @return Index of the active copy.
+     */
+    static size_t selectActiveCopy(uint8_t i_flags0, uint8_t i_flags1) noexcept;
+
+  private:
+    /**
+     * @brief Location of a copy of the environment.
+     */
+    struct Copy
+    {
+        std::string m_device;
+        off_t m_offset = 0;
+        size_t m_size = 0;
+
+        // Erase size, 0 if not given.
+        size_t m_sectorSize = 0;
+    };
+
+    /**
+     * @brief API to read the environment into cache, if not already read.
+     *
+     * Caller should hold m_mutex.
+     *
+     * @throw std::runtime_error if fw_env.config is missing or invalid.
+     */
+    void load();
+
+    /**
+     * @brief API to read locations of environment copies from fw_env.config.
+     *
+     * @throw std::runtime_error if the config is missing or invalid.
+     *
+     * @return Locations of the copies.
+     */
+    static std::vector<Copy> readConfig();
+
+    /**
+     * @brief API to read a copy of environment and validate its CRC.
+     *
+     * @param[in] i_copy - Location of the copy.
+     * @param[in] i_isRedundant - Whether the copy carries flags.
+     *
+     * @return Flags and data area of the copy, std::nullopt if the copy could
+     * not be read or is corrupt.
+     */
+    static std::optional<std::pair<uint8_t, types::BinaryVector>> readCopy(
+        const Copy& i_copy, bool i_isRedundant) noexcept;
+
+    /**
+     * @brief API to write an image of environment to a copy.
+     *
+     * @param[in] i_copy - Location of the copy.
+     * @param[in] i_image - Image to write, of size of the copy.
+     *
+     * @throw std::runtime_error if the write fails.
+     */
+    static void writeCopy(const Copy& i_copy,
+                          const types::BinaryVector& i_image);
+
+    // Mutex to guard the cached environment below.
+    std::mutex m_mutex;
+
+    bool m_isLoaded = false;
+    std::vector<Copy> m_copies;
+
+    // Index of copy in use and its flags, flags are not used if there is a
+    // single copy.
+    size_t m_activeCopy = 0;
+    uint8_t m_flags = 0;
+
+    // Variables in the order they are stored.
+    std::vector<std::pair<std::string, std::string>> m_variables;
+};
+} // namespace vpd
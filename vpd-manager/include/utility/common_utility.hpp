@@ -3,9 +3,23 @@
 #include "constants.hpp"
 #include "logger.hpp"
 
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <array>
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -48,60 +62,208 @@ constexpr auto toHex(size_t i_aByte)
 }
 
 /**
- * @brief API to return null at the end of variadic template args.
+ * @brief API to run a process and collect its output.
+ *
+ * The process is spawned directly with the given arguments, without a shell.
+ * Program is looked up in PATH unless it is a path.
  *
- * @return empty string.
+ * @throw std::runtime_error if the process could not be run, or it didn't
+ * exit with status 0.
+ *
+ * @param[in] i_args - Program followed by its arguments.
+ * @returns Output of the process, one entry per line.
  */
-inline std::string getCommand()
+inline std::vector<std::string> runProcess(
+    const std::vector<std::string>& i_args)
 {
-    return "";
+    if (i_args.empty())
+    {
+        throw std::runtime_error("No program given to run.");
+    }
+
+    std::array<int, 2> l_pipe;
+    if (pipe2(l_pipe.data(), O_CLOEXEC) != 0)
+    {
+        throw std::runtime_error(
+            "pipe failed with error " + std::string(strerror(errno)));
+    }
+
+    std::vector<char*> l_argv;
+    l_argv.reserve(i_args.size() + 1);
+    for (const auto& l_arg : i_args)
+    {
+        l_argv.push_back(const_cast<char*>(l_arg.c_str()));
+    }
+    l_argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t l_fileActions;
+    posix_spawn_file_actions_init(&l_fileActions);
+    posix_spawn_file_actions_adddup2(&l_fileActions, l_pipe[1], STDOUT_FILENO);
+
+    pid_t l_pid = 0;
+    const int l_rc = posix_spawnp(&l_pid, l_argv[0], &l_fileActions, nullptr,
+                                  l_argv.data(), environ);
+
+    posix_spawn_file_actions_destroy(&l_fileActions);
+    close(l_pipe[1]);
+
+    if (l_rc != 0)
+    {
+        close(l_pipe[0]);
+        throw std::runtime_error("Failed to spawn " + i_args[0] +
+                                 ", error: " + std::string(strerror(l_rc)));
+    }
+
+    std::string l_output;
+    std::array<char, constants::CMD_BUFFER_LENGTH> l_buffer;
+    while (true)
+    {
+        const ssize_t l_bytesRead =
+            read(l_pipe[0], l_buffer.data(), l_buffer.size());
+
+        if (l_bytesRead > 0)
+        {
+            l_output.append(l_buffer.data(), l_bytesRead);
+        }
+        else if (l_bytesRead == 0 || errno != EINTR)
+        {
+            break;
+        }
+    }
+    close(l_pipe[0]);
+
+    int l_status = 0;
+    while (waitpid(l_pid, &l_status, 0) < 0 && errno == EINTR)
+    {}
+
+    if (!WIFEXITED(l_status))
+    {
+        throw std::runtime_error(i_args[0] + " terminated abnormally, status " +
+                                 std::to_string(l_status));
+    }
+
+    if (WEXITSTATUS(l_status) != 0)
+    {
+        throw std::runtime_error(i_args[0] + " exited with status " +
+                                 std::to_string(WEXITSTATUS(l_status)));
+    }
+
+    std::vector<std::string> l_cmdOutput;
+    size_t l_lineStart = 0;
+    while (l_lineStart < l_output.size())
+    {
+        size_t l_lineEnd = l_output.find('\n', l_lineStart);
+        l_lineEnd =
+            (l_lineEnd == std::string::npos) ? l_output.size() : l_lineEnd + 1;
+
+        l_cmdOutput.emplace_back(l_output, l_lineStart,
+                                 l_lineEnd - l_lineStart);
+        l_lineStart = l_lineEnd;
+    }
+
+    return l_cmdOutput;
 }
 
 /**
- * @brief API to arrange create command.
+ * @brief API to write a value to a sysfs attribute.
+ *
+ * @throw std::runtime_error.
  *
- * @param[in] arguments to create the command
- * @return Command string
+ * @param[in] i_attributePath - Path to the attribute.
+ * @param[in] i_value - Value to write.
  */
-template <typename T, typename... Types>
-inline std::string getCommand(T i_arg1, Types... i_args)
+inline void writeSysfsAttribute(const std::string& i_attributePath,
+                                const std::string& i_value)
 {
-    std::string l_cmd = " " + i_arg1 + getCommand(i_args...);
+    const int l_fd = open(i_attributePath.c_str(), O_WRONLY | O_CLOEXEC);
+    if (l_fd < 0)
+    {
+        throw std::runtime_error("Failed to open " + i_attributePath +
+                                 ", error: " + std::string(strerror(errno)));
+    }
+
+    // Attribute takes the whole value in a single write.
+    const ssize_t l_bytesWritten = write(l_fd, i_value.data(), i_value.size());
+    const int l_errno = errno;
+    close(l_fd);
 
-    return l_cmd;
+    if (l_bytesWritten != static_cast<ssize_t>(i_value.size()))
+    {
+        throw std::runtime_error(
+            "Failed to write to " + i_attributePath + ", error: " +
+            std::string(strerror(l_bytesWritten < 0 ? l_errno : EIO)));
+    }
 }
 
 /**
- * @brief API to create shell command and execute.
+ * @brief API to execute a system command given as shell command line.
  *
- * @throw std::runtime_error.
+ * A command of the form "echo <value> > <path>" is carried out by writing the
+ * value to the path directly. Any other command without shell syntax is
+ * spawned with its words as arguments. Only commands using shell syntax are
+ * run through a shell.
  *
- * @param[in] arguments for command
- * @returns output of that command
+ * @throw std::runtime_error if the command could not be run or failed, e.g.
+ * the write to the path failed or the command exited with non zero status.
+ *
+ * @param[in] i_command - Command line.
  */
-template <typename T, typename... Types>
-inline std::vector<std::string> executeCmd(T&& i_path, Types... i_args)
+inline void executeSystemCmd(const std::string& i_command)
 {
-    std::vector<std::string> l_cmdOutput;
-    std::array<char, constants::CMD_BUFFER_LENGTH> l_buffer;
+    // Characters which need the command to be interpreted by a shell.
+    constexpr auto l_shellSyntax = "|&;<`$(){}*?[]~'\"\\\t\n";
 
-    std::string l_cmd = i_path + getCommand(i_args...);
+    if (i_command.find_first_of(l_shellSyntax) != std::string::npos ||
+        std::ranges::count(i_command, '>') > 1)
+    {
+        runProcess({"/bin/sh", "-c", i_command});
+        return;
+    }
 
-    std::unique_ptr<FILE, decltype(&pclose)> l_cmdPipe(
-        popen(l_cmd.c_str(), "r"), pclose);
+    const auto l_splitWords = [](std::string_view i_text) {
+        std::vector<std::string> l_words;
+        for (const auto l_word : i_text | std::views::split(' '))
+        {
+            if (!l_word.empty())
+            {
+                l_words.emplace_back(l_word.begin(), l_word.end());
+            }
+        }
+        return l_words;
+    };
 
-    if (!l_cmdPipe)
+    const size_t l_redirectPos = i_command.find('>');
+    if (l_redirectPos == std::string::npos)
     {
-        logging::logMessage(
-            "popen failed with error " + std::string(strerror(errno)));
-        throw std::runtime_error("popen failed!");
+        const std::vector<std::string> l_args = l_splitWords(i_command);
+        if (!l_args.empty())
+        {
+            runProcess(l_args);
+        }
+        return;
     }
-    while (fgets(l_buffer.data(), l_buffer.size(), l_cmdPipe.get()) != nullptr)
+
+    const std::vector<std::string> l_echoWords =
+        l_splitWords(std::string_view(i_command).substr(0, l_redirectPos));
+    const std::vector<std::string> l_pathWords =
+        l_splitWords(std::string_view(i_command).substr(l_redirectPos + 1));
+
+    if (l_echoWords.empty() || l_echoWords.front() != "echo" ||
+        (l_echoWords.size() > 1 && l_echoWords[1].starts_with('-')) ||
+        l_pathWords.size() != 1)
     {
-        l_cmdOutput.emplace_back(l_buffer.data());
+        runProcess({"/bin/sh", "-c", i_command});
+        return;
     }
 
-    return l_cmdOutput;
+    std::string l_value;
+    for (size_t l_index = 1; l_index < l_echoWords.size(); ++l_index)
+    {
+        l_value += (l_index > 1 ? " " : "") + l_echoWords[l_index];
+    }
+    l_value += '\n';
+
+    writeSysfsAttribute(l_pathWords.front(), l_value);
 }
 
 /** @brief Converts string to lower case.
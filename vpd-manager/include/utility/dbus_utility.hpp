@@ -5,7 +5,12 @@
 #include "logger.hpp"
 #include "types.hpp"
 
+#include <boost/asio/post.hpp>
+#include <sdbusplus/asio/connection.hpp>
+
 #include <chrono>
+#include <functional>
+#include <optional>
 
 namespace vpd
 {
@@ -15,6 +20,23 @@ namespace vpd
 namespace dbusUtility
 {
 
+/**
+ * @brief An API to get D-Bus connection for the calling thread.
+ *
+ * Setting up a connection (socket, authentication and Hello handshake) costs
+ * more than most of the calls made over it. Hence a connection is created
+ * once per thread on first use and is reused for all subsequent calls from
+ * that thread. As sd-bus connections are not thread safe, connections are
+ * not shared across threads.
+ *
+ * @return Reference to D-Bus connection owned by the calling thread.
+ */
+inline sdbusplus::bus_t& getBus()
+{
+    thread_local sdbusplus::bus_t l_bus = sdbusplus::bus::new_default();
+    return l_bus;
+}
+
 /**
  * @brief An API to get Map of service and interfaces for an object path.
  *
@@ -44,7 +66,7 @@ inline types::MapperGetObject getObjectMap(const std::string& objectPath,
 
     try
     {
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method = bus.new_method_call(
             "xyz.openbmc_project.ObjectMapper",
             "/xyz/openbmc_project/object_mapper",
@@ -92,7 +114,7 @@ inline types::PropertyMap getPropertyMap(const std::string& i_service,
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method =
             l_bus.new_method_call(i_service.c_str(), i_objectPath.c_str(),
                                   "org.freedesktop.DBus.Properties", "GetAll");
@@ -108,6 +130,49 @@ inline types::PropertyMap getPropertyMap(const std::string& i_service,
     return l_propertyValueMap;
 }
 
+/**
+ * @brief An API to get all objects managed by a service.
+ *
+ * This API calls GetManagedObjects on the object manager of the service and
+ * returns all the objects, their interfaces and properties in one go.
+ *
+ * Note: An empty map means the service manages no object. On failure, callers
+ * need to fall back to querying the objects they need.
+ *
+ * @param[in] i_service - Service name.
+ * @param[in] i_objectManagerPath - Path of the object manager.
+ *
+ * @return - A map of object, its interfaces and properties, if success. If
+ *           failed, std::nullopt.
+ */
+inline std::optional<types::ObjectMap> getManagedObjects(
+    const std::string& i_service, const std::string& i_objectManagerPath)
+{
+    types::ObjectMap l_objectMap;
+    if (i_service.empty() || i_objectManagerPath.empty())
+    {
+        logging::logMessage("Invalid parameters to get managed objects");
+        return std::nullopt;
+    }
+
+    try
+    {
+        auto& l_bus = getBus();
+        auto l_method = l_bus.new_method_call(
+            i_service.c_str(), i_objectManagerPath.c_str(),
+            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        auto l_result = l_bus.call(l_method);
+        l_result.read(l_objectMap);
+    }
+    catch (const sdbusplus::exception::SdBusError& l_ex)
+    {
+        logging::logMessage(l_ex.what());
+        return std::nullopt;
+    }
+
+    return l_objectMap;
+}
+
 /**
  * @brief API to get object subtree from D-bus.
  *
@@ -142,7 +207,7 @@ inline types::MapperGetSubTree getObjectSubTree(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::objectMapperService, constants::objectMapperPath,
             constants::objectMapperInf, "GetSubTree");
@@ -192,7 +257,7 @@ inline types::DbusVariantType readDbusProperty(
 
     try
     {
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method =
             bus.new_method_call(serviceName.c_str(), objectPath.c_str(),
                                 "org.freedesktop.DBus.Properties", "Get");
@@ -236,7 +301,7 @@ inline bool writeDbusProperty(
             throw std::runtime_error("Dbus write failed, Parameter empty");
         }
 
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method =
             bus.new_method_call(serviceName.c_str(), objectPath.c_str(),
                                 "org.freedesktop.DBus.Properties", "Set");
@@ -253,6 +318,34 @@ inline bool writeDbusProperty(
     }
 }
 
+/**
+ * @brief API to make object paths relative to PIM root.
+ *
+ * PIM Notify expects object paths relative to its root path. Objects which
+ * are not under PIM root path are dropped from the map.
+ *
+ * @param[in,out] io_objectMap - Object, its interface and data.
+ */
+inline void removePimPathPrefix(types::ObjectMap& io_objectMap)
+{
+    types::ObjectMap l_objectMap;
+
+    while (!io_objectMap.empty())
+    {
+        auto l_nodeHandle = io_objectMap.extract(io_objectMap.begin());
+
+        if (l_nodeHandle.key().str.find(constants::pimPath, 0) !=
+            std::string::npos)
+        {
+            l_nodeHandle.key() = l_nodeHandle.key().str.replace(
+                0, std::strlen(constants::pimPath), "");
+            l_objectMap.insert(std::move(l_nodeHandle));
+        }
+    }
+
+    io_objectMap = std::move(l_objectMap);
+}
+
 /**
  * @brief API to publish data on PIM
  *
@@ -265,20 +358,9 @@ inline bool callPIM(types::ObjectMap&& objectMap)
 {
     try
     {
-        for (const auto& l_objectKeyValue : objectMap)
-        {
-            auto l_nodeHandle = objectMap.extract(l_objectKeyValue.first);
-
-            if (l_nodeHandle.key().str.find(constants::pimPath, 0) !=
-                std::string::npos)
-            {
-                l_nodeHandle.key() = l_nodeHandle.key().str.replace(
-                    0, std::strlen(constants::pimPath), "");
-                objectMap.insert(std::move(l_nodeHandle));
-            }
-        }
+        removePimPathPrefix(objectMap);
 
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto pimMsg =
             bus.new_method_call(constants::pimServiceName, constants::pimPath,
                                 constants::pimIntf, "Notify");
@@ -292,6 +374,45 @@ inline bool callPIM(types::ObjectMap&& objectMap)
     return true;
 }
 
+/**
+ * @brief API to publish data on PIM asynchronously.
+ *
+ * The API queues notify on PIM object and returns without waiting for PIM to
+ * process it. The call is posted to the connection's IO context, hence the API
+ * can be called from any thread. Completion handler is invoked on the IO
+ * context's thread.
+ *
+ * @param[in] i_asioConnection - Asio connection to make the call on.
+ * @param[in] i_objectMap - Object, its interface and data.
+ * @param[in] i_callback - Completion handler, called with status of notify.
+ */
+inline void callPIMAsync(
+    const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection,
+    types::ObjectMap&& i_objectMap, std::function<void(bool)> i_callback)
+{
+    removePimPathPrefix(i_objectMap);
+
+    boost::asio::post(
+        i_asioConnection->get_io_context(),
+        [i_asioConnection, l_objectMap = std::move(i_objectMap),
+         l_callback = std::move(i_callback)]() {
+            try
+            {
+                i_asioConnection->async_method_call(
+                    [l_callback](const boost::system::error_code& l_ec) {
+                        l_callback(!l_ec);
+                    },
+                    constants::pimServiceName, constants::pimPath,
+                    constants::pimIntf, "Notify", l_objectMap);
+            }
+            catch (const sdbusplus::exception::SdBusError& l_ex)
+            {
+                logging::logMessage(l_ex.what());
+                l_callback(false);
+            }
+        });
+}
+
 /**
  * @brief API to check if a D-Bus service is running or not.
  *
@@ -308,7 +429,7 @@ inline bool isServiceRunning(const std::string& i_serviceName)
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             "org.freedesktop.DBus", "/org/freedesktop/DBus",
             "org.freedesktop.DBus", "NameHasOwner");
@@ -345,7 +466,7 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
     types::BiosGetAttrRetType l_attributeVal;
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
             constants::biosConfigMgrInterface, "GetAttribute");
@@ -367,6 +488,60 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
     return std::get<1>(l_attributeVal);
 }
 
+/**
+ * @brief API to read current value of BIOS attributes in one call.
+ *
+ * The API reads "BaseBIOSTable" property of BIOS manager and returns current
+ * value of the requested attributes. Attributes not found in the table are not
+ * part of the returned map.
+ * API returns an empty map in case of any error.
+ *
+ * @param[in] i_attributeNames - Attributes to be read.
+ * @return Map of attribute name to its current value.
+ */
+inline types::BiosAttributeValueMap biosGetAttributesFromBaseTable(
+    const std::vector<std::string>& i_attributeNames) noexcept
+{
+    types::BiosAttributeValueMap l_attributeValues;
+    try
+    {
+        auto& l_bus = getBus();
+        auto l_method = l_bus.new_method_call(
+            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
+            "org.freedesktop.DBus.Properties", "Get");
+        l_method.append(constants::biosConfigMgrInterface, "BaseBIOSTable");
+
+        auto l_result = l_bus.call(l_method);
+
+        std::variant<std::map<std::string, types::BiosProperty>> l_baseTable;
+        l_result.read(l_baseTable);
+
+        const auto& l_attributeList = std::get<0>(l_baseTable);
+        for (const auto& l_attributeName : i_attributeNames)
+        {
+            const auto l_itrToAttribute = l_attributeList.find(l_attributeName);
+            if (l_itrToAttribute == l_attributeList.end())
+            {
+                continue;
+            }
+
+            std::visit(
+                [&l_attributeValues, &l_attributeName](const auto& l_value) {
+                    l_attributeValues.emplace(l_attributeName, l_value);
+                },
+                std::get<5>(l_itrToAttribute->second));
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage(
+            "Failed to read BIOS base table due to error " +
+            std::string(l_ex.what()));
+    }
+
+    return l_attributeValues;
+}
+
 /**
  * @brief API to check if Chassis is powered on.
  *
@@ -378,13 +553,12 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
 inline bool isChassisPowerOn()
 {
     auto powerState = dbusUtility::readDbusProperty(
-        "xyz.openbmc_project.State.Chassis",
-        "/xyz/openbmc_project/state/chassis0",
-        "xyz.openbmc_project.State.Chassis", "CurrentPowerState");
+        constants::chassisStateService, constants::chassisStateObjectPath,
+        constants::chassisStateInterface, constants::currentPowerStateProperty);
 
     if (auto curPowerState = std::get_if<std::string>(&powerState))
     {
-        if ("xyz.openbmc_project.State.Chassis.PowerState.On" == *curPowerState)
+        if (constants::chassisPowerOnState == *curPowerState)
         {
             return true;
         }
@@ -463,7 +637,7 @@ inline int EnableRebootGuard() noexcept
     int l_rc{constants::FAILURE};
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::systemdService, constants::systemdObjectPath,
             constants::systemdManagerInterface, "StartUnit");
@@ -500,7 +674,7 @@ inline int DisableRebootGuard() noexcept
         int l_dBusCallRc{constants::FAILURE};
         try
         {
-            auto l_bus = sdbusplus::bus::new_default();
+            auto& l_bus = getBus();
             auto l_method = l_bus.new_method_call(
                 constants::systemdService, constants::systemdObjectPath,
                 constants::systemdManagerInterface, "StartUnit");
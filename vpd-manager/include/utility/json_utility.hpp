@@ -2,10 +2,10 @@
 
 #include "event_logger.hpp"
 #include "exceptions.hpp"
+#include "gpio_service.hpp"
 #include "logger.hpp"
 #include "types.hpp"
 
-#include <gpiod.hpp>
 #include <nlohmann/json.hpp>
 #include <utility/common_utility.hpp>
 
@@ -22,23 +22,27 @@ namespace jsonUtility
 bool processSystemCmdTag(const nlohmann::json& i_parsedConfigJson,
                          const std::string& i_vpdFilePath,
                          const std::string& i_baseAction,
-                         const std::string& i_flagToProcess);
+                         const std::string& i_flagToProcess,
+                         GpioService& io_gpioService);
 
 // forward declaration of API for function map.
 bool processGpioPresenceTag(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_vpdFilePath,
-    const std::string& i_baseAction, const std::string& i_flagToProcess);
+    const std::string& i_baseAction, const std::string& i_flagToProcess,
+    GpioService& io_gpioService);
 
 // forward declaration of API for function map.
 bool procesSetGpioTag(const nlohmann::json& i_parsedConfigJson,
                       const std::string& i_vpdFilePath,
                       const std::string& i_baseAction,
-                      const std::string& i_flagToProcess);
+                      const std::string& i_flagToProcess,
+                      GpioService& io_gpioService);
 
 // Function pointers to process tags from config JSON.
 typedef bool (*functionPtr)(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_vpdFilePath,
-    const std::string& i_baseAction, const std::string& i_flagToProcess);
+    const std::string& i_baseAction, const std::string& i_flagToProcess,
+    GpioService& io_gpioService);
 
 inline std::unordered_map<std::string, functionPtr> funcionMap{
     {"gpioPresence", processGpioPresenceTag},
@@ -205,11 +209,13 @@ inline std::string getInventoryObjPathFromJson(
  * @param[in] i_vpdFilePath - EEPROM file path
  * @param[in] i_flagToProcess - To identify which flag(s) needs to be processed
  * under PostFailAction tag of config JSON.
+ * @param[in,out] io_gpioService - GPIO service to access the lines.
  * @return - success or failure
  */
 inline bool executePostFailAction(const nlohmann::json& i_parsedConfigJson,
                                   const std::string& i_vpdFilePath,
-                                  const std::string& i_flagToProcess)
+                                  const std::string& i_flagToProcess,
+                                  GpioService& io_gpioService)
 {
     try
     {
@@ -236,7 +242,8 @@ inline bool executePostFailAction(const nlohmann::json& i_parsedConfigJson,
             if (itrToFunction != funcionMap.end())
             {
                 if (!itrToFunction->second(i_parsedConfigJson, i_vpdFilePath,
-                                           "postFailAction", i_flagToProcess))
+                                           "postFailAction", i_flagToProcess,
+                                           io_gpioService))
                 {
                     return false;
                 }
@@ -264,11 +271,13 @@ inline bool executePostFailAction(const nlohmann::json& i_parsedConfigJson,
  * @param[in] i_baseAction - Base action for which this tag has been called.
  * @param[in] i_flagToProcess - Flag nested under the base action for which this
  * tag has been called.
+ * @param[in,out] io_gpioService - GPIO service, unused by the tag.
  * @return Execution status.
  */
 inline bool processSystemCmdTag(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_vpdFilePath,
-    const std::string& i_baseAction, const std::string& i_flagToProcess)
+    const std::string& i_baseAction, const std::string& i_flagToProcess,
+    [[maybe_unused]] GpioService& io_gpioService)
 {
     try
     {
@@ -294,12 +303,12 @@ inline bool processSystemCmdTag(
             i_parsedConfigJson["frus"][i_vpdFilePath].at(
                 0)[i_baseAction][i_flagToProcess]["systemCmd"]["cmd"];
 
-        commonUtility::executeCmd(l_systemCommand);
+        commonUtility::executeSystemCmd(l_systemCommand);
         return true;
     }
     catch (const std::exception& l_ex)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             EventLogger::getErrorType(l_ex), types::SeverityType::Informational,
             __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(l_ex),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
@@ -318,11 +327,13 @@ inline bool processSystemCmdTag(
  * @param[in] i_baseAction - Base action for which this tag has been called.
  * @param[in] i_flagToProcess - Flag nested under the base action for which this
  * tag has been called.
+ * @param[in,out] io_gpioService - GPIO service to read the line.
  * @return Execution status.
  */
 inline bool processGpioPresenceTag(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_vpdFilePath,
-    const std::string& i_baseAction, const std::string& i_flagToProcess)
+    const std::string& i_baseAction, const std::string& i_flagToProcess,
+    GpioService& io_gpioService)
 {
     std::string l_presencePinName;
     try
@@ -357,17 +368,10 @@ inline bool processGpioPresenceTag(
             i_parsedConfigJson["frus"][i_vpdFilePath].at(
                 0)[i_baseAction][i_flagToProcess]["gpioPresence"]["value"];
 
-        gpiod::line l_presenceLine = gpiod::find_line(l_presencePinName);
-
-        if (!l_presenceLine)
-        {
-            throw GpioException("Couldn't find the GPIO line.");
-        }
-
-        l_presenceLine.request({"Read the presence line",
-                                gpiod::line_request::DIRECTION_INPUT, 0});
-
-        return (l_presencePinValue == l_presenceLine.get_value());
+        // Line may already be requested for presence monitoring.
+        return (l_presencePinValue ==
+                io_gpioService.getValue(l_presencePinName,
+                                        "Read the presence line"));
     }
     catch (const std::exception& l_ex)
     {
@@ -378,7 +382,7 @@ inline bool processGpioPresenceTag(
         if (EventLogger::getErrorType(l_ex) == types::ErrorType::JsonFailure ||
             EventLogger::getErrorType(l_ex) == types::ErrorType::FirmwareError)
         {
-            EventLogger::createSyncPel(
+            EventLogger::createQueuedPel(
                 EventLogger::getErrorType(l_ex),
                 types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
                 EventLogger::getErrorMsg(l_ex), std::nullopt, std::nullopt,
@@ -420,11 +424,13 @@ inline bool processGpioPresenceTag(
  * @param[in] i_baseAction - Base action for which this tag has been called.
  * @param[in] i_flagToProcess - Flag nested under the base action for which this
  * tag has been called.
+ * @param[in,out] io_gpioService - GPIO service to set the line.
  * @return Execution status.
  */
 inline bool procesSetGpioTag(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_vpdFilePath,
-    const std::string& i_baseAction, const std::string& i_flagToProcess)
+    const std::string& i_baseAction, const std::string& i_flagToProcess,
+    GpioService& io_gpioService)
 {
     std::string l_pinName;
     try
@@ -460,23 +466,16 @@ inline bool procesSetGpioTag(
         logging::logMessage(
             "Setting GPIO: " + l_pinName + " to " + std::to_string(l_pinValue));
 
-        gpiod::line l_outputLine = gpiod::find_line(l_pinName);
-
-        if (!l_outputLine)
-        {
-            throw GpioException("Couldn't find GPIO line.");
-        }
-
-        l_outputLine.request(
-            {"FRU Action", ::gpiod::line_request::DIRECTION_OUTPUT, 0},
-            l_pinValue);
+        // Line stays requested as output, so it keeps being driven to the
+        // value. Later actions on the same line only update the value.
+        io_gpioService.setValue(l_pinName, "FRU Action", l_pinValue);
         return true;
     }
     catch (const std::exception& l_ex)
     {
         if (EventLogger::getErrorType(l_ex) != types::ErrorType::GpioError)
         {
-            EventLogger::createSyncPel(
+            EventLogger::createQueuedPel(
                 EventLogger::getErrorType(l_ex),
                 types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
                 EventLogger::getErrorMsg(l_ex), std::nullopt, std::nullopt,
@@ -521,11 +520,13 @@ inline bool procesSetGpioTag(
  * @param[in] i_vpdFilePath - EEPROM file path
  * @param[in] i_flagToProcess - To identify which flag(s) needs to be processed
  * under PreAction tag of config JSON.
+ * @param[in,out] io_gpioService - GPIO service to access the lines.
  * @return - success or failure
  */
 inline bool executeBaseAction(
     const nlohmann::json& i_parsedConfigJson, const std::string& i_action,
-    const std::string& i_vpdFilePath, const std::string& i_flagToProcess)
+    const std::string& i_vpdFilePath, const std::string& i_flagToProcess,
+    GpioService& io_gpioService)
 {
     try
     {
@@ -560,7 +561,7 @@ inline bool executeBaseAction(
     }
     catch (const std::exception& l_ex)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             EventLogger::getErrorType(l_ex), types::SeverityType::Informational,
             __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(l_ex),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
@@ -577,7 +578,8 @@ inline bool executeBaseAction(
         if (itrToFunction != funcionMap.end())
         {
             if (!itrToFunction->second(i_parsedConfigJson, i_vpdFilePath,
-                                       i_action, i_flagToProcess))
+                                       i_action, i_flagToProcess,
+                                       io_gpioService))
             {
                 // In case any of the tag fails to execute. Mark action
                 // as failed for that flag.
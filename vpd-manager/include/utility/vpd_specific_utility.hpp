@@ -15,6 +15,7 @@
 #include <filesystem>
 #include <fstream>
 #include <regex>
+#include <set>
 #include <typeindex>
 
 namespace vpd
@@ -167,8 +168,9 @@ inline std::string getKwVal(const types::IPZKwdValueMap& i_kwdValueMap,
     }
     catch (const std::exception& l_ex)
     {
-        logging::logMessage("Failed to get value for keyword [" + i_kwd +
-                            "]. Error : " + l_ex.what());
+        logging::logMessage<logging::LogLevel::Debug>(
+            "Failed to get value for keyword [" + i_kwd +
+            "]. Error : " + l_ex.what());
     }
     return l_kwdValue;
 }
@@ -282,14 +284,20 @@ inline int insertOrMerge(types::InterfaceMap& io_map,
  * Note: The API handles all the exception internally, in case of any error
  * unexpanded location code will be returned as it is.
  *
+ * Keyword values are picked from the FRU's own parsed VPD if it carries the
+ * required record, else from the cached system keywords, and only if both of
+ * them miss, from D-Bus.
+ *
  * @param[in] unexpandedLocationCode - Unexpanded location code.
  * @param[in] parsedVpdMap - Parsed VPD map.
+ * @param[in] i_sysKwdCache - Cached VCEN/VSYS keywords of system VPD.
  * @return Expanded location code. In case of any error, unexpanded is returned
  * as it is.
  */
 inline std::string getExpandedLocationCode(
     const std::string& unexpandedLocationCode,
-    const types::VPDMapVariant& parsedVpdMap)
+    const types::VPDMapVariant& parsedVpdMap,
+    const types::IPZVpdMap& i_sysKwdCache = types::IPZVpdMap{})
 {
     auto expanded{unexpandedLocationCode};
 
@@ -330,18 +338,33 @@ inline std::string getExpandedLocationCode(
 
         std::string firstKwdValue, secondKwdValue;
 
+        // Record holding required keywords, either from FRU's own VPD or from
+        // cached system VPD.
+        const types::IPZKwdValueMap* l_kwdValueMap = nullptr;
+
         if (auto ipzVpdMap = std::get_if<types::IPZVpdMap>(&parsedVpdMap);
             ipzVpdMap && (*ipzVpdMap).find(recordName) != (*ipzVpdMap).end())
         {
-            auto itrToVCEN = (*ipzVpdMap).find(recordName);
-            firstKwdValue = getKwVal(itrToVCEN->second, kwd1);
+            l_kwdValueMap = &((*ipzVpdMap).find(recordName)->second);
+        }
+        else if (auto l_itrToRecord = i_sysKwdCache.find(recordName);
+                 l_itrToRecord != i_sysKwdCache.end() &&
+                 l_itrToRecord->second.contains(kwd1) &&
+                 l_itrToRecord->second.contains(kwd2))
+        {
+            l_kwdValueMap = &(l_itrToRecord->second);
+        }
+
+        if (l_kwdValueMap != nullptr)
+        {
+            firstKwdValue = getKwVal(*l_kwdValueMap, kwd1);
             if (firstKwdValue.empty())
             {
                 throw std::runtime_error(
                     "Failed to get value for keyword [" + kwd1 + "]");
             }
 
-            secondKwdValue = getKwVal(itrToVCEN->second, kwd2);
+            secondKwdValue = getKwVal(*l_kwdValueMap, kwd2);
             if (secondKwdValue.empty())
             {
                 throw std::runtime_error(
@@ -564,11 +587,99 @@ inline bool findCcinInVpd(const nlohmann::json& i_JsonObject,
     return l_rc;
 }
 
+/**
+ * @brief API to check if an interface under PIM holds VPD related data.
+ *
+ * @param[in] i_interface - Interface name.
+ *
+ * @return true if data of the interface needs to be reset along with VPD,
+ * false otherwise.
+ */
+inline bool isVpdRelatedInterface(const std::string& i_interface) noexcept
+{
+    static const std::vector<std::string> l_vpdRelatedInterfaces{
+        constants::operationalStatusInf, constants::inventoryItemInf,
+        constants::assetInf, constants::vpdCollectionInterface};
+
+    return (i_interface.find(constants::ipzVpdInf) != std::string::npos) ||
+           (std::find(l_vpdRelatedInterfaces.begin(),
+                      l_vpdRelatedInterfaces.end(), i_interface) !=
+            l_vpdRelatedInterfaces.end());
+}
+
+/**
+ * @brief API to get reset data of a FRU from its data under PIM.
+ *
+ * This API picks VPD related interfaces from the given PIM data of a FRU and
+ * fills in reset values for their properties.
+ *
+ * @param[in] i_pimInterfaceMap - Interfaces and properties of the FRU under
+ * PIM.
+ * @param[in,out] io_interfaceMap - Interface and its properties map.
+ */
+inline void resetDataUnderPIM(const types::InterfaceMap& i_pimInterfaceMap,
+                              types::InterfaceMap& io_interfaceMap)
+{
+    for (const auto& [l_interface, l_propertyValueMap] : i_pimInterfaceMap)
+    {
+        if (!isVpdRelatedInterface(l_interface))
+        {
+            continue;
+        }
+
+        types::PropertyMap l_propertyMap;
+
+        for (const auto& l_aProperty : l_propertyValueMap)
+        {
+            const std::string& l_propertyName = l_aProperty.first;
+            const auto& l_propertyValue = l_aProperty.second;
+
+            if (std::holds_alternative<types::BinaryVector>(l_propertyValue))
+            {
+                l_propertyMap.emplace(l_propertyName, types::BinaryVector{});
+            }
+            else if (std::holds_alternative<std::string>(l_propertyValue))
+            {
+                if (l_propertyName.compare("CollectionStatus") ==
+                    constants::STR_CMP_SUCCESS)
+                {
+                    l_propertyMap.emplace(l_propertyName,
+                                          constants::vpdCollectionNotStarted);
+                }
+                else
+                {
+                    l_propertyMap.emplace(l_propertyName, std::string{});
+                }
+            }
+            else if (std::holds_alternative<bool>(l_propertyValue))
+            {
+                if (l_propertyName.compare("Present") ==
+                    constants::STR_CMP_SUCCESS)
+                {
+                    l_propertyMap.emplace(l_propertyName, false);
+                }
+                else if (l_propertyName.compare("Functional") ==
+                         constants::STR_CMP_SUCCESS)
+                {
+                    // Since FRU is not present functional property
+                    // is considered as true.
+                    l_propertyMap.emplace(l_propertyName, true);
+                }
+            }
+        }
+        io_interfaceMap.emplace(l_interface, std::move(l_propertyMap));
+    }
+}
+
 /**
  * @brief API to reset data of a FRU populated under PIM.
  *
  * This API resets the data for particular interfaces of a FRU under PIM.
  *
+ * Note: The API reads FRU's data from D-Bus. If data of many FRUs needs to be
+ * reset, prefer fetching PIM data once through
+ * dbusUtility::getManagedObjects and use the overload taking PIM data.
+ *
  * @param[in] i_objectPath - DBus object path of the FRU.
  * @param[in] io_interfaceMap - Interface and its properties map.
  */
@@ -581,10 +692,6 @@ inline void resetDataUnderPIM(const std::string& i_objectPath,
         const types::MapperGetObject& l_getObjectMap =
             dbusUtility::getObjectMap(i_objectPath, l_interfaces);
 
-        const std::vector<std::string>& l_vpdRelatedInterfaces{
-            constants::operationalStatusInf, constants::inventoryItemInf,
-            constants::assetInf, constants::vpdCollectionInterface};
-
         for (const auto& [l_service, l_interfaceList] : l_getObjectMap)
         {
             if (l_service.compare(constants::pimServiceName) !=
@@ -593,67 +700,20 @@ inline void resetDataUnderPIM(const std::string& i_objectPath,
                 continue;
             }
 
+            types::InterfaceMap l_pimInterfaceMap;
             for (const auto& l_interface : l_interfaceList)
             {
-                if ((l_interface.find(constants::ipzVpdInf) !=
-                     std::string::npos) ||
-                    ((std::find(l_vpdRelatedInterfaces.begin(),
-                                l_vpdRelatedInterfaces.end(), l_interface)) !=
-                     l_vpdRelatedInterfaces.end()))
+                if (!isVpdRelatedInterface(l_interface))
                 {
-                    const types::PropertyMap& l_propertyValueMap =
-                        dbusUtility::getPropertyMap(l_service, i_objectPath,
-                                                    l_interface);
-
-                    types::PropertyMap l_propertyMap;
-
-                    for (const auto& l_aProperty : l_propertyValueMap)
-                    {
-                        const std::string& l_propertyName = l_aProperty.first;
-                        const auto& l_propertyValue = l_aProperty.second;
-
-                        if (std::holds_alternative<types::BinaryVector>(
-                                l_propertyValue))
-                        {
-                            l_propertyMap.emplace(l_propertyName,
-                                                  types::BinaryVector{});
-                        }
-                        else if (std::holds_alternative<std::string>(
-                                     l_propertyValue))
-                        {
-                            if (l_propertyName.compare("CollectionStatus") ==
-                                constants::STR_CMP_SUCCESS)
-                            {
-                                l_propertyMap.emplace(
-                                    l_propertyName,
-                                    constants::vpdCollectionNotStarted);
-                            }
-                            else
-                            {
-                                l_propertyMap.emplace(l_propertyName,
-                                                      std::string{});
-                            }
-                        }
-                        else if (std::holds_alternative<bool>(l_propertyValue))
-                        {
-                            if (l_propertyName.compare("Present") ==
-                                constants::STR_CMP_SUCCESS)
-                            {
-                                l_propertyMap.emplace(l_propertyName, false);
-                            }
-                            else if (l_propertyName.compare("Functional") ==
-                                     constants::STR_CMP_SUCCESS)
-                            {
-                                // Since FRU is not present functional property
-                                // is considered as true.
-                                l_propertyMap.emplace(l_propertyName, true);
-                            }
-                        }
-                    }
-                    io_interfaceMap.emplace(l_interface,
-                                            std::move(l_propertyMap));
+                    continue;
                 }
+
+                l_pimInterfaceMap.emplace(
+                    l_interface, dbusUtility::getPropertyMap(
+                                     l_service, i_objectPath, l_interface));
             }
+
+            resetDataUnderPIM(l_pimInterfaceMap, io_interfaceMap);
         }
     }
     catch (const std::exception& l_ex)
@@ -820,89 +880,6 @@ inline bool isPowerVsImage()
     return false;
 }
 
-/**
- * @brief API to sync keyword update to inherited FRUs.
- *
- * For a given keyword update on a EEPROM path, this API syncs the keyword
- * update to all inherited FRUs' respective interface, property on PIM.
- *
- * @param[in] i_fruPath - EEPROM path of FRU.
- * @param[in] i_paramsToWriteData - Input details.
- * @param[in] i_sysCfgJsonObj - System config JSON.
- *
- */
-inline void updateKwdOnInheritedFrus(
-    const std::string& i_fruPath,
-    const types::WriteVpdParams& i_paramsToWriteData,
-    const nlohmann::json& i_sysCfgJsonObj) noexcept
-{
-    try
-    {
-        if (!i_sysCfgJsonObj.contains("frus"))
-        {
-            throw std::runtime_error("Mandatory tag(s) missing from JSON");
-        }
-
-        if (!i_sysCfgJsonObj["frus"].contains(i_fruPath))
-        {
-            throw std::runtime_error(
-                "VPD path [" + i_fruPath + "] not found in system config JSON");
-        }
-
-        const types::IpzData* l_ipzData =
-            std::get_if<types::IpzData>(&i_paramsToWriteData);
-
-        if (!l_ipzData)
-        {
-            throw std::runtime_error("Unsupported VPD type");
-        }
-        //  iterate through all inventory paths for given EEPROM path,
-        //  except the base FRU.
-        //  if for an inventory path, "inherit" tag is true,
-        //  update the inventory path's com.ibm.ipzvpd.<record>,keyword
-        //  property
-
-        types::ObjectMap l_objectInterfaceMap;
-
-        auto l_populateInterfaceMap =
-            [&l_objectInterfaceMap,
-             &l_ipzData = std::as_const(l_ipzData)](const auto& l_Fru) {
-                // update inherited FRUs only
-                if (l_Fru.value("inherit", true))
-                {
-                    l_objectInterfaceMap.emplace(
-                        sdbusplus::message::object_path{l_Fru["inventoryPath"]},
-                        types::InterfaceMap{
-                            {std::string{constants::ipzVpdInf +
-                                         std::get<0>(*l_ipzData)},
-                             types::PropertyMap{{std::get<1>(*l_ipzData),
-                                                 std::get<2>(*l_ipzData)}}}});
-                }
-            };
-
-        // iterate through all FRUs except the base FRU
-        std::for_each(
-            i_sysCfgJsonObj["frus"][i_fruPath].begin() + constants::VALUE_1,
-            i_sysCfgJsonObj["frus"][i_fruPath].end(), l_populateInterfaceMap);
-
-        if (!l_objectInterfaceMap.empty())
-        {
-            // notify PIM
-            if (!dbusUtility::callPIM(move(l_objectInterfaceMap)))
-            {
-                throw std::runtime_error(
-                    "Call to PIM failed for VPD file " + i_fruPath);
-            }
-        }
-    }
-    catch (const std::exception& l_ex)
-    {
-        logging::logMessage(
-            "Failed to sync keyword update to inherited FRUs of FRU [" +
-            i_fruPath + "]. Error: " + std::string(l_ex.what()));
-    }
-}
-
 /**
  * @brief API to get common interface(s) properties corresponding to given
  * record and keyword.
@@ -978,30 +955,30 @@ inline types::InterfaceMap getCommonInterfaceProperties(
 }
 
 /**
- * @brief API to update common interface(s) properties when keyword is updated.
+ * @brief API to get D-Bus updates corresponding to a keyword update.
  *
- * For a given keyword update on a EEPROM path, this API syncs the keyword
- * update to respective common interface(s) properties of the base FRU and all
+ * For a given keyword update on a EEPROM path, this API walks the FRU's
+ * entries in the system config JSON once and populates,
+ * 1. keyword's property of the base FRU and all inherited FRUs.
+ * 2. respective common interface(s) properties of the base FRU and all
  * inherited FRUs.
  *
  * @param[in] i_fruPath - EEPROM path of FRU.
- * @param[in] i_paramsToWriteData - Input details.
+ * @param[in] i_paramsToWriteData - Input details, value should be the one
+ * present on hardware after the update.
  * @param[in] i_sysCfgJsonObj - System config JSON.
  *
+ * @return Object map to notify PIM with. Empty if there is nothing to update
+ * or on failure.
  */
-inline void updateCiPropertyOfInheritedFrus(
+inline types::ObjectMap getKeywordUpdateObjectMap(
     const std::string& i_fruPath,
     const types::WriteVpdParams& i_paramsToWriteData,
     const nlohmann::json& i_sysCfgJsonObj) noexcept
 {
+    types::ObjectMap l_objectInterfaceMap;
     try
     {
-        if (!i_sysCfgJsonObj.contains("commonInterfaces"))
-        {
-            // no common interfaces in JSON, nothing to do
-            return;
-        }
-
         if (!i_sysCfgJsonObj.contains("frus"))
         {
             throw std::runtime_error("Mandatory tag(s) missing from JSON");
@@ -1013,59 +990,118 @@ inline void updateCiPropertyOfInheritedFrus(
                 "VPD path [" + i_fruPath + "] not found in system config JSON");
         }
 
-        if (!std::get_if<types::IpzData>(&i_paramsToWriteData))
+        const types::IpzData* l_ipzData =
+            std::get_if<types::IpzData>(&i_paramsToWriteData);
+
+        if (!l_ipzData)
         {
             throw std::runtime_error("Unsupported VPD type");
         }
 
-        //  iterate through all inventory paths for given EEPROM path,
-        //  if for an inventory path, "inherit" tag is true,
-        //  update the inventory path's com.ibm.ipzvpd.<record>,keyword
-        //  property
+        const types::InterfaceMap l_commonInterfaceMap =
+            i_sysCfgJsonObj.contains("commonInterfaces")
+                ? getCommonInterfaceProperties(
+                      i_paramsToWriteData, i_sysCfgJsonObj["commonInterfaces"])
+                : types::InterfaceMap{};
 
-        types::ObjectMap l_objectInterfaceMap;
+        const std::string l_interfaceName =
+            constants::ipzVpdInf + std::get<0>(*l_ipzData);
+        const std::string l_propertyName =
+            getDbusPropNameForGivenKw(std::get<1>(*l_ipzData));
 
-        const types::InterfaceMap l_interfaceMap = getCommonInterfaceProperties(
-            i_paramsToWriteData, i_sysCfgJsonObj["commonInterfaces"]);
+        bool l_isBaseFru = true;
 
-        if (l_interfaceMap.empty())
+        for (const auto& l_fru : i_sysCfgJsonObj["frus"][i_fruPath])
         {
-            // nothing to do
-            return;
-        }
+            const bool l_isInherited = l_fru.value("inherit", true);
+            const std::string l_inventoryPath =
+                l_fru.value("inventoryPath", "");
 
-        auto l_populateObjectInterfaceMap =
-            [&l_objectInterfaceMap, &l_interfaceMap = std::as_const(
-                                        l_interfaceMap)](const auto& l_Fru) {
-                if (l_Fru.value("inherit", true) &&
-                    l_Fru.contains("inventoryPath"))
+            if (!l_inventoryPath.empty() && (l_isBaseFru || l_isInherited))
+            {
+                types::InterfaceMap l_interfaceMap{
+                    {l_interfaceName,
+                     types::PropertyMap{
+                         {l_propertyName, std::get<2>(*l_ipzData)}}}};
+
+                // common interfaces are updated for inherited FRUs only.
+                if (l_isInherited)
                 {
-                    l_objectInterfaceMap.emplace(
-                        sdbusplus::message::object_path{l_Fru["inventoryPath"]},
-                        l_interfaceMap);
+                    l_interfaceMap.insert(l_commonInterfaceMap.begin(),
+                                          l_commonInterfaceMap.end());
                 }
-            };
-
-        std::for_each(i_sysCfgJsonObj["frus"][i_fruPath].begin(),
-                      i_sysCfgJsonObj["frus"][i_fruPath].end(),
-                      l_populateObjectInterfaceMap);
 
-        if (!l_objectInterfaceMap.empty())
-        {
-            // notify PIM
-            if (!dbusUtility::callPIM(move(l_objectInterfaceMap)))
-            {
-                throw std::runtime_error(
-                    "Call to PIM failed for VPD file " + i_fruPath);
+                l_objectInterfaceMap.emplace(
+                    sdbusplus::message::object_path{l_inventoryPath},
+                    std::move(l_interfaceMap));
             }
+
+            l_isBaseFru = false;
         }
     }
     catch (const std::exception& l_ex)
     {
         logging::logMessage(
-            "Failed to update common interface properties of FRU [" +
+            "Failed to get D-Bus updates for keyword update on FRU [" +
             i_fruPath + "]. Error: " + std::string(l_ex.what()));
+        l_objectInterfaceMap.clear();
+    }
+    return l_objectInterfaceMap;
+}
+
+/**
+ * @brief API to record changed BIOS attributes pending sync to VPD.
+ *
+ * Latest value of each attribute is kept pending, unless it is same as the
+ * value last synced to VPD, in which case any pending change of it is dropped.
+ * So an attribute changed and changed back before the sync is not synced.
+ *
+ * @param[in] i_lastSeenAttributes - Attribute values in sync with VPD.
+ * @param[in] i_attributes - Attribute values from the change signal.
+ * @param[in,out] io_pendingAttributes - Attribute values pending sync.
+ */
+inline void updatePendingBiosAttributes(
+    const types::BiosAttributeValueMap& i_lastSeenAttributes,
+    const types::BiosAttributeValueMap& i_attributes,
+    types::BiosAttributeValueMap& io_pendingAttributes)
+{
+    for (const auto& [l_attributeName, l_value] : i_attributes)
+    {
+        const auto l_itrToLastSeen = i_lastSeenAttributes.find(l_attributeName);
+        if (l_itrToLastSeen != i_lastSeenAttributes.end() &&
+            l_itrToLastSeen->second == l_value)
+        {
+            io_pendingAttributes.erase(l_attributeName);
+            continue;
+        }
+
+        io_pendingAttributes.insert_or_assign(l_attributeName, l_value);
+    }
+}
+
+/**
+ * @brief API to get keywords changed between two sets of keyword values.
+ *
+ * @param[in] i_before - Keyword values before the change.
+ * @param[in] i_after - Keyword values after the change.
+ *
+ * @return Keywords of i_after which are not in i_before or whose value
+ * differs from i_before.
+ */
+inline std::set<types::IpzType> getChangedKeywords(
+    const types::IpzTypeValueMap& i_before,
+    const types::IpzTypeValueMap& i_after)
+{
+    std::set<types::IpzType> l_changedKeywords;
+    for (const auto& [l_recordKeyword, l_value] : i_after)
+    {
+        const auto l_itrToBefore = i_before.find(l_recordKeyword);
+        if (l_itrToBefore == i_before.end() || l_itrToBefore->second != l_value)
+        {
+            l_changedKeywords.insert(l_recordKeyword);
+        }
     }
+    return l_changedKeywords;
 }
 } // namespace vpdSpecificUtility
 } // namespace vpd
@@ -1,14 +1,24 @@
 #pragma once
 
 #include "constants.hpp"
+#include "eeprom_watcher.hpp"
+#include "eeprom_write_queue.hpp"
+#include "gpio_service.hpp"
+#include "parsed_vpd_cache.hpp"
+#include "system_state_cache.hpp"
 #include "types.hpp"
+#include "uboot_env.hpp"
 
 #include <nlohmann/json.hpp>
+#include <sdbusplus/asio/connection.hpp>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <semaphore>
 #include <tuple>
+#include <unordered_map>
 
 namespace vpd
 {
@@ -37,23 +47,27 @@ class Worker
     /**
      * @brief Constructor.
      *
-     * In case the processing is not JSON based, no argument needs to be passed.
-     * Constructor will also, based on symlink pick the correct JSON and
+     * In case the processing is not JSON based, an empty path needs to be
+     * passed. Constructor will also, based on symlink pick the correct JSON and
      * initialize the parsed JSON variable.
      *
      * @param[in] pathToConfigJSON - Path to the config JSON, if applicable.
+     * @param[in] i_uBootEnv - U-Boot environment, shared with the owner.
+     * @param[in] i_systemStateCache - System state, shared with the owner.
      * @param[in] i_maxThreadCount - Maximum thread while collecting FRUs VPD.
      *
      * Note: Throws std::exception in case of construction failure. Caller needs
      * to handle to detect successful object creation.
      */
-    Worker(std::string pathToConfigJson = std::string(),
+    Worker(std::string pathToConfigJson,
+           const std::shared_ptr<UBootEnv>& i_uBootEnv,
+           const std::shared_ptr<SystemStateCache>& i_systemStateCache,
            uint8_t i_maxThreadCount = constants::MAX_THREADS);
 
     /**
      * @brief Destructor
      */
-    ~Worker() = default;
+    ~Worker();
 
     /**
      * @brief An API to check if system VPD is already published.
@@ -74,6 +88,111 @@ class Worker
      */
     void collectFrusFromJson();
 
+    /**
+     * @brief API to snapshot D-Bus state required during bulk FRU collection.
+     *
+     * Chassis power state and the list of inventory objects already hosting
+     * OperationalStatus and Enable interfaces under PIM are read once, so
+     * that processing of each FRU doesn't need to query D-Bus again. Presence
+     * pins of all the FRUs are sampled together as well. The snapshot is used
+     * until clearCollectionContext is called or collection of all the FRUs is
+     * over.
+     */
+    void createCollectionContext();
+
+    /**
+     * @brief API to drop the snapshot taken by createCollectionContext.
+     *
+     * Subsequent processing falls back to querying D-Bus directly.
+     */
+    void clearCollectionContext();
+
+    /**
+     * @brief API to cache system keywords required for location code
+     * expansion.
+     *
+     * FC and SE from VCEN, TM and SE from VSYS are picked from the given
+     * parsed system VPD, so that location codes can be expanded without
+     * reading them back from D-Bus.
+     *
+     * @param[in] i_ipzVpdMap - Parsed system VPD.
+     */
+    void cacheSystemKeywords(const types::IPZVpdMap& i_ipzVpdMap);
+
+    /**
+     * @brief API to update a cached system keyword.
+     *
+     * Called on every successful write of system VPD through the EEPROM write
+     * queue, keywords which are not cached are ignored.
+     *
+     * @param[in] i_recordName - Record name.
+     * @param[in] i_keywordName - Keyword name.
+     * @param[in] i_value - Value written to the keyword.
+     */
+    void updateCachedSystemKeyword(const std::string& i_recordName,
+                                   const std::string& i_keywordName,
+                                   const types::BinaryVector& i_value);
+
+    /**
+     * @brief API to get cached system keywords.
+     *
+     * @return Cached records and keywords, empty if system VPD is not cached
+     * yet.
+     */
+    types::IPZVpdMap getCachedSystemKeywords() const;
+
+    /**
+     * @brief API to get parsed VPD of an EEPROM from cache.
+     *
+     * VPD parsed to serve a read is cached against the EEPROM path till the
+     * EEPROM is written to, recollected or the FRU is deleted.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Parsed VPD if cached, std::nullopt otherwise.
+     */
+    std::optional<types::VPDMapVariant>
+        getCachedParsedVpd(const std::string& i_vpdFilePath) const;
+
+    /**
+     * @brief API to get generation of cached parsed VPD of an EEPROM.
+     *
+     * Generation changes every time cached VPD of the EEPROM is invalidated.
+     * It should be read before the EEPROM is parsed, and passed on to cache
+     * the parsed VPD.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Generation of the EEPROM.
+     */
+    uint64_t getParsedVpdGeneration(const std::string& i_vpdFilePath) const;
+
+    /**
+     * @brief API to cache parsed VPD of an EEPROM.
+     *
+     * At most constants::MAX_PARSED_VPD_CACHE_ENTRIES EEPROMs are cached, the
+     * one cached first is dropped to make room.
+     *
+     * VPD is not cached if the EEPROM has been invalidated since it was
+     * parsed, as the VPD may then be stale.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_parsedVpd - Parsed VPD of the EEPROM.
+     * @param[in] i_generation - Generation of the EEPROM read before parsing.
+     */
+    void cacheParsedVpd(const std::string& i_vpdFilePath,
+                        const types::VPDMapVariant& i_parsedVpd,
+                        uint64_t i_generation);
+
+    /**
+     * @brief API to invalidate cached parsed VPD of an EEPROM.
+     *
+     * Needs to be called whenever VPD of the EEPROM is updated or removed.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     */
+    void invalidateParsedVpd(const std::string& i_vpdFilePath);
+
     /**
      * @brief API to parse VPD data
      *
@@ -111,19 +230,64 @@ class Worker
      */
     inline bool isAllFruCollectionDone() const
     {
-        return m_isAllFruCollected;
+        return m_isAllFruCollected && !m_pendingPimNotifyCount;
+    }
+
+    /**
+     * @brief API to set asio connection to publish VPD asynchronously.
+     *
+     * Once set, VPD of FRUs collected in bulk is published to PIM without
+     * waiting for PIM to process it, so that parsing of next FRU overlaps with
+     * publishing of the previous one.
+     *
+     * @param[in] i_asioConnection - Asio connection.
+     */
+    inline void setAsioConnection(
+        const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection)
+    {
+        m_asioConnection = i_asioConnection;
     }
 
     /**
      * @brief API to get system config JSON object
      *
-     * @return System config JSON object.
+     * The JSON is handed out as an immutable, reference counted snapshot. The
+     * snapshot stays valid for as long as the caller holds it, even if the
+     * worker swaps in a different system config JSON in the meantime.
+     *
+     * @return System config JSON object, never null.
      */
-    inline nlohmann::json getSysCfgJsonObj() const
+    inline std::shared_ptr<const nlohmann::json> getSysCfgJsonObj() const
     {
+        std::lock_guard<std::mutex> l_lock(m_sysCfgJsonMutex);
         return m_parsedJson;
     }
 
+    /**
+     * @brief API to get GPIO service of the worker.
+     *
+     * Lines requested through the service stay requested for lifetime of the
+     * worker.
+     *
+     * @return GPIO service.
+     */
+    inline GpioService& getGpioService()
+    {
+        return m_gpioService;
+    }
+
+    /**
+     * @brief API to get queue to write keywords through.
+     *
+     * Writes through the queue keep caches of the worker in sync.
+     *
+     * @return Write queue.
+     */
+    inline const std::shared_ptr<EepromWriteQueue>& getEepromWriteQueue() const
+    {
+        return m_eepromWriteQueue;
+    }
+
     /**
      * @brief API to get active thread count.
      *
@@ -178,6 +342,17 @@ class Worker
      */
     bool primeInventory(const std::string& i_vpdFilePath);
 
+    /**
+     * @brief API to prime inventory Objects of a list of FRUs.
+     *
+     * Data under PIM is fetched once for all the FRUs and all the primed
+     * objects are published to PIM in a single call.
+     *
+     * @param[in] i_vpdFilePaths - List of EEPROM file paths.
+     * @return true if priming is success for all the FRUs, false otherwise.
+     */
+    bool primeInventory(const std::vector<std::string>& i_vpdFilePaths);
+
     /**
      * @brief An API to set appropriate device tree and JSON.
      *
@@ -190,6 +365,125 @@ class Worker
     void setDeviceTreeAndJson();
 
   private:
+    /**
+     * @brief API to process a keyword written through the EEPROM write queue.
+     *
+     * Keeps data cached against the EEPROM in sync with hardware, whichever
+     * path the write came through.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     * @param[in] i_paramsToWriteData - Data written.
+     */
+    void processKeywordWrite(const std::string& i_eepromPath,
+                             const types::WriteVpdParams& i_paramsToWriteData);
+
+    /**
+     * @brief API to check if JSON loaded through symlink is the selected one.
+     *
+     * JSON is loaded through the symlink at construction if the symlink is
+     * already present. It can be used as is if system VPD selects the same
+     * JSON.
+     *
+     * @param[in] i_systemJson - Path to JSON selected as per system VPD.
+     *
+     * @return true if the loaded JSON is the selected one, false otherwise.
+     */
+    bool isLinkedJsonSelected(const std::string& i_systemJson) const;
+
+    /**
+     * @brief D-Bus state captured once for bulk FRU collection.
+     */
+    struct CollectionContext
+    {
+        // Chassis power state at the time of snapshot.
+        bool m_isChassisPowerOn = false;
+
+        // Inventory object path to interfaces hosted under PIM.
+        std::unordered_map<std::string, std::vector<std::string>>
+            m_pimInterfaces;
+
+        // Presence pin name to its value sampled at the time of snapshot.
+        std::unordered_map<std::string, int> m_presencePinValues;
+    };
+
+    /**
+     * @brief API to get the current collection context, if any.
+     *
+     * @return Collection context, nullptr if there is no bulk collection in
+     * progress.
+     */
+    std::shared_ptr<const CollectionContext> getCollectionContext() const;
+
+    /**
+     * @brief API to check if an interface is already hosted by PIM.
+     *
+     * Served from collection context when available, else queried from
+     * mapper.
+     *
+     * @param[in] i_inventoryObjPath - Inventory path as read from config JSON.
+     * @param[in] i_interface - Interface to check.
+     *
+     * @return true if PIM hosts the interface on the object, false otherwise.
+     */
+    bool isInterfaceUnderPim(const std::string& i_inventoryObjPath,
+                             const std::string& i_interface) const;
+
+    /**
+     * @brief API to get chassis power state.
+     *
+     * Served from collection context when available, else read from D-Bus.
+     *
+     * @return true if chassis is powered on, false otherwise.
+     */
+    bool isChassisPowerOn() const;
+
+    /**
+     * @brief API to check if a FRU is absent as per collection context.
+     *
+     * Presence of the FRU is checked against the value of its presence pin,
+     * as given under pre-action for collection in config JSON, sampled in
+     * the collection context. Sample is used only by threads of the bulk
+     * collection pass, any other collection, like CollectFRUVPD or hot plug,
+     * reads the pin afresh. As the sample is taken before pre-actions of
+     * other FRUs are run, a FRU sampled as absent is confirmed by reading the
+     * pin again.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path of the FRU.
+     *
+     * @return true if the FRU is confirmed absent, false if it is sampled as
+     * present, there is no sample for it or the pin could not be read.
+     */
+    bool isFruAbsentInCollectionContext(
+        const std::string& i_vpdFilePath) const noexcept;
+
+    /**
+     * @brief API to populate primed inventory objects of a FRU.
+     *
+     * @param[in] i_vpdFilePath - EEPROM file path.
+     * @param[in] i_pimObjects - Data under PIM to reset FRU data from. If not
+     * given, data of the FRU is read from D-Bus.
+     * @param[in,out] io_objectInterfaceMap - Map to hold primed objects.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool populatePrimeObjectMap(
+        const std::string& i_vpdFilePath,
+        const std::optional<types::ObjectMap>& i_pimObjects,
+        types::ObjectMap& io_objectInterfaceMap);
+
+    /**
+     * @brief API to publish VPD of a FRU to PIM asynchronously.
+     *
+     * Blocks only if there are already MAX_PIM_NOTIFY_IN_FLIGHT notify calls
+     * pending. In case notify fails, collection status of the FRU is set to
+     * failure from the completion handler.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path of the FRU.
+     * @param[in] i_objectMap - Object, its interface and data.
+     */
+    void notifyPimAsync(const std::string& i_vpdFilePath,
+                        types::ObjectMap&& i_objectMap);
+
     /**
      * @brief An API to parse and publish a FRU VPD over D-Bus.
      *
@@ -543,8 +837,13 @@ class Worker
     void setCollectionStatusProperty(const std::string& i_fruPath,
                                      const std::string& i_value) const noexcept;
 
-    // Parsed JSON file.
-    nlohmann::json m_parsedJson{};
+    // Parsed JSON file. Published as an immutable snapshot, the pointer is
+    // only re-seated in setDeviceTreeAndJson under m_sysCfgJsonMutex.
+    std::shared_ptr<const nlohmann::json> m_parsedJson{
+        std::make_shared<const nlohmann::json>()};
+
+    // Mutex to guard publishing of m_parsedJson snapshot.
+    mutable std::mutex m_sysCfgJsonMutex;
 
     // Hold if symlink is present or not.
     bool m_isSymlinkPresent = false;
@@ -571,5 +870,46 @@ class Worker
 
     // List of EEPROM paths for which VPD collection thread creation has failed.
     std::forward_list<std::string> m_failedEepromPaths;
+
+    // D-Bus state snapshot used while collecting FRUs in bulk.
+    std::shared_ptr<const CollectionContext> m_collectionContext;
+
+    // Mutex to guard m_collectionContext.
+    mutable std::mutex m_collectionContextMutex;
+
+    // Asio connection to publish VPD asynchronously, if set.
+    std::shared_ptr<sdbusplus::asio::connection> m_asioConnection;
+
+    // Limits number of PIM notify calls in flight.
+    std::counting_semaphore<constants::MAX_PIM_NOTIFY_IN_FLIGHT>
+        m_pimNotifySemaphore{constants::MAX_PIM_NOTIFY_IN_FLIGHT};
+
+    // Number of PIM notify calls yet to complete.
+    std::atomic<size_t> m_pendingPimNotifyCount{0};
+
+    // System VPD keywords required for location code expansion.
+    types::IPZVpdMap m_systemKeywordCache;
+
+    // Mutex to guard m_systemKeywordCache.
+    mutable std::mutex m_systemKeywordCacheMutex;
+
+    // Parsed VPD of EEPROMs read.
+    ParsedVpdCache m_parsedVpdCache;
+
+    // Waits for EEPROMs to appear after their pre-action.
+    EepromWatcher m_eepromWatcher;
+
+    // Lines requested for actions and presence of FRUs.
+    GpioService m_gpioService;
+
+    // Queue to serialise keyword writes on EEPROMs.
+    std::shared_ptr<EepromWriteQueue> m_eepromWriteQueue =
+        std::make_shared<EepromWriteQueue>();
+
+    // U-Boot environment to read and set the device tree.
+    std::shared_ptr<UBootEnv> m_uBootEnv;
+
+    // Chassis, host and BMC state.
+    std::shared_ptr<SystemStateCache> m_systemStateCache;
 };
 } // namespace vpd
@@ -3,6 +3,7 @@
 #include "ibm_handler.hpp"
 
 #include "parser.hpp"
+#include "system_state_cache.hpp"
 
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
@@ -16,34 +17,42 @@ IbmHandler::IbmHandler(
     std::shared_ptr<BackupAndRestore>& o_backupAndRestoreObj,
     const std::shared_ptr<sdbusplus::asio::dbus_interface>& i_iFace,
     const std::shared_ptr<boost::asio::io_context>& i_ioCon,
-    const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection) :
+    const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection,
+    const std::shared_ptr<UBootEnv>& i_uBootEnv,
+    const std::shared_ptr<SystemStateCache>& i_systemStateCache) :
     m_worker(o_worker), m_backupAndRestoreObj(o_backupAndRestoreObj),
     m_interface(i_iFace), m_ioContext(i_ioCon),
-    m_asioConnection(i_asioConnection)
+    m_asioConnection(i_asioConnection), m_systemStateCache(i_systemStateCache)
 {
-    if (dbusUtility::isChassisPowerOn())
+    if (m_systemStateCache->isChassisPowerOn())
     {
         // At power on, less number of FRU(s) needs collection. we can scale
         // down the threads to reduce CPU utilization.
-        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT,
+        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT, i_uBootEnv,
+                                            m_systemStateCache,
                                             constants::VALUE_1);
     }
     else
     {
         // Initialize with default configuration
-        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT);
+        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT, i_uBootEnv,
+                                            m_systemStateCache);
     }
 
+    // Publish VPD of FRUs collected in bulk without blocking on PIM.
+    m_worker->setAsioConnection(m_asioConnection);
+
     // Set up minimal things that is needed before bus name is claimed.
     performInitialSetup();
 
-    if (!m_sysCfgJsonObj.empty() &&
-        jsonUtility::isBackupAndRestoreRequired(m_sysCfgJsonObj))
+    if (!m_sysCfgJsonObj->empty() &&
+        jsonUtility::isBackupAndRestoreRequired(*m_sysCfgJsonObj))
     {
         try
         {
             m_backupAndRestoreObj =
-                std::make_shared<BackupAndRestore>(m_sysCfgJsonObj);
+                std::make_shared<BackupAndRestore>(
+                    *m_sysCfgJsonObj, m_worker->getEepromWriteQueue());
         }
         catch (const std::exception& l_ex)
         {
@@ -257,7 +266,8 @@ void IbmHandler::checkAndUpdatePowerVsVpd(
 {
     for (const auto& [l_fruPath, l_recJson] : i_powerVsJsonObj.items())
     {
-        nlohmann::json l_sysCfgJsonObj{};
+        std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+            std::make_shared<const nlohmann::json>();
         if (m_worker.get() != nullptr)
         {
             l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
@@ -266,7 +276,7 @@ void IbmHandler::checkAndUpdatePowerVsVpd(
         // The utility method will handle emty JSON case. No explicit
         // handling required here.
         auto l_inventoryPath = jsonUtility::getInventoryObjPathFromJson(
-            l_sysCfgJsonObj, l_fruPath);
+            *l_sysCfgJsonObj, l_fruPath);
 
         // Mark it as failed if inventory path not found in JSON.
         if (l_inventoryPath.empty())
@@ -347,7 +357,8 @@ void IbmHandler::checkAndUpdatePowerVsVpd(
 
                 // Update part number only if required.
                 std::shared_ptr<Parser> l_parserObj =
-                    std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj);
+                    std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj,
+                                             m_worker->getEepromWriteQueue());
                 if (l_parserObj->updateVpdKeyword(std::make_tuple(
                         l_recordName, l_kwdName, l_binaryKwdValue)) ==
                     constants::FAILURE)
@@ -504,14 +515,21 @@ void IbmHandler::hostStateChangeCallBack(sdbusplus::message_t& i_msg)
 
 void IbmHandler::primeSystemBlueprint()
 {
-    if (m_sysCfgJsonObj.empty())
+    if (m_sysCfgJsonObj->empty() || m_worker.get() == nullptr)
+    {
+        return;
+    }
+
+    if (!m_sysCfgJsonObj->contains("frus"))
     {
+        logging::logMessage("Missing frus tag in system config JSON");
         return;
     }
 
     const nlohmann::json& l_listOfFrus =
-        m_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
+        m_sysCfgJsonObj->at("frus").get_ref<const nlohmann::json::object_t&>();
 
+    std::vector<std::string> l_vpdFilePaths;
     for (const auto& l_itemFRUS : l_listOfFrus.items())
     {
         const std::string& l_vpdFilePath = l_itemFRUS.key();
@@ -521,43 +539,56 @@ void IbmHandler::primeSystemBlueprint()
             continue;
         }
 
-        // Prime the inventry for FRUs which
-        // are not present/processing had some error.
-        if (m_worker.get() != nullptr &&
-            !m_worker->primeInventory(l_vpdFilePath))
-        {
-            logging::logMessage(
-                "Priming of inventory failed for FRU " + l_vpdFilePath);
-        }
+        l_vpdFilePaths.push_back(l_vpdFilePath);
     }
+
+    // Snapshot D-Bus state once for priming all the FRUs.
+    m_worker->createCollectionContext();
+
+    // Prime the inventry for FRUs which
+    // are not present/processing had some error.
+    if (!m_worker->primeInventory(l_vpdFilePaths))
+    {
+        logging::logMessage("Priming of inventory failed for some FRU(s)");
+    }
+
+    m_worker->clearCollectionContext();
 }
 
 void IbmHandler::enableMuxChips()
 {
-    if (m_sysCfgJsonObj.empty())
+    if (m_sysCfgJsonObj->empty())
     {
         // config JSON should not be empty at this point of execution.
         throw std::runtime_error("Config JSON is empty. Can't enable muxes");
         return;
     }
 
-    if (!m_sysCfgJsonObj.contains("muxes"))
+    if (!m_sysCfgJsonObj->contains("muxes"))
     {
         logging::logMessage("No mux defined for the system in config JSON");
         return;
     }
 
     // iterate over each MUX detail and enable them.
-    for (const auto& item : m_sysCfgJsonObj["muxes"])
+    for (const auto& item : m_sysCfgJsonObj->at("muxes"))
     {
         if (item.contains("holdidlepath"))
         {
-            std::string cmd = "echo 0 > ";
-            cmd += item["holdidlepath"];
+            const std::string& l_holdIdlePath = item["holdidlepath"];
 
-            logging::logMessage("Enabling mux with command = " + cmd);
+            logging::logMessage("Enabling mux with hold idle path = " +
+                                l_holdIdlePath);
 
-            commonUtility::executeCmd(cmd);
+            try
+            {
+                commonUtility::writeSysfsAttribute(l_holdIdlePath, "0\n");
+            }
+            catch (const std::exception& l_ex)
+            {
+                logging::logMessage("Failed to enable mux, error: " +
+                                    std::string(l_ex.what()));
+            }
             continue;
         }
 
@@ -577,7 +608,7 @@ void IbmHandler::performInitialSetup()
         }
 
         m_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-        if (!dbusUtility::isChassisPowerOn())
+        if (!m_systemStateCache->isChassisPowerOn())
         {
             m_worker->setDeviceTreeAndJson();
 
@@ -35,13 +35,17 @@ class IbmHandler
      * @param[in] i_iFace - interface to implement.
      * @param[in] i_ioCon - IO context.
      * @param[in] i_asioConnection - Dbus Connection.
+     * @param[in] i_uBootEnv - U-Boot environment, to pass to worker.
+     * @param[in] i_systemStateCache - System state.
      */
     IbmHandler(
         std::shared_ptr<Worker>& o_worker,
         std::shared_ptr<BackupAndRestore>& o_backupAndRestoreObj,
         const std::shared_ptr<sdbusplus::asio::dbus_interface>& i_iFace,
         const std::shared_ptr<boost::asio::io_context>& i_ioCon,
-        const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection);
+        const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection,
+        const std::shared_ptr<UBootEnv>& i_uBootEnv,
+        const std::shared_ptr<SystemStateCache>& i_systemStateCache);
 
   private:
     /**
@@ -145,8 +149,9 @@ class IbmHandler
      */
     void enableMuxChips();
 
-    // Parsed system config json object.
-    nlohmann::json m_sysCfgJsonObj{};
+    // Snapshot of parsed system config json object.
+    std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj{
+        std::make_shared<const nlohmann::json>()};
 
     // Shared pointer to worker class
     std::shared_ptr<Worker>& m_worker;
@@ -165,5 +170,8 @@ class IbmHandler
 
     // Shared pointer to bus connection.
     const std::shared_ptr<sdbusplus::asio::connection>& m_asioConnection;
+
+    // Shared pointer to system state cache.
+    std::shared_ptr<SystemStateCache> m_systemStateCache;
 };
 } // namespace vpd
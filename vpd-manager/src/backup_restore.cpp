@@ -15,8 +15,11 @@ namespace vpd
 BackupAndRestoreStatus BackupAndRestore::m_backupAndRestoreStatus =
     BackupAndRestoreStatus::NotStarted;
 
-BackupAndRestore::BackupAndRestore(const nlohmann::json& i_sysCfgJsonObj) :
-    m_sysCfgJsonObj(i_sysCfgJsonObj)
+BackupAndRestore::BackupAndRestore(
+    const nlohmann::json& i_sysCfgJsonObj,
+    std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue) :
+    m_sysCfgJsonObj(i_sysCfgJsonObj),
+    m_eepromWriteQueue(std::move(i_eepromWriteQueue))
 {
     std::string l_backupAndRestoreCfgFilePath =
         i_sysCfgJsonObj.value("backupRestoreConfigPath", "");
@@ -184,6 +187,61 @@ void BackupAndRestore::backupAndRestoreIpzVpd(
         return;
     }
 
+    // Keywords' value from DBus, for the side whose VPD map isn't available.
+    types::IPZVpdMap l_srcDbusVpdMap;
+    types::IPZVpdMap l_dstDbusVpdMap;
+
+    // Gets keyword's value from the VPD map if available, else from DBus.
+    // Keywords are fetched from DBus once per record.
+    auto l_getKeywordValue =
+        [](const types::IPZVpdMap& i_vpdMap, types::IPZVpdMap& io_dbusVpdMap,
+           const std::string& i_serviceName, const std::string& i_inventoryPath,
+           const std::string& i_recordName,
+           const std::string& i_keywordName) -> types::BinaryVector {
+        if (!i_vpdMap.empty())
+        {
+            const std::string l_value = vpdSpecificUtility::getKwVal(
+                i_vpdMap.at(i_recordName), i_keywordName);
+            return types::BinaryVector(l_value.begin(), l_value.end());
+        }
+
+        auto l_recordItr = io_dbusVpdMap.find(i_recordName);
+        if (l_recordItr == io_dbusVpdMap.end())
+        {
+            types::IPZKwdValueMap l_kwdValueMap;
+            for (const auto& [l_property, l_value] :
+                 dbusUtility::getPropertyMap(i_serviceName, i_inventoryPath,
+                                             constants::ipzVpdInf +
+                                                 i_recordName))
+            {
+                if (const auto l_binaryValue =
+                        std::get_if<types::BinaryVector>(&l_value))
+                {
+                    l_kwdValueMap.emplace(
+                        l_property, std::string(l_binaryValue->begin(),
+                                                l_binaryValue->end()));
+                }
+            }
+            l_recordItr =
+                io_dbusVpdMap.emplace(i_recordName, std::move(l_kwdValueMap))
+                    .first;
+        }
+
+        const auto l_kwdItr = l_recordItr->second.find(i_keywordName);
+        if (l_kwdItr == l_recordItr->second.end())
+        {
+            return types::BinaryVector{};
+        }
+        return types::BinaryVector(l_kwdItr->second.begin(),
+                                   l_kwdItr->second.end());
+    };
+
+    // Keywords to be updated on source and destination hardware.
+    std::vector<types::WriteVpdParams> l_srcUpdates;
+    std::vector<types::WriteVpdParams> l_dstUpdates;
+
+    // Compare source and destination keywords in one pass, hardware updates
+    // are collected and done at the end.
     for (const auto& l_aRecordKwInfo :
          m_backupAndRestoreCfgJsonObj["backupMap"])
     {
@@ -240,69 +298,13 @@ void BackupAndRestore::backupAndRestoreIpzVpd(
 
         bool l_isPelRequired = l_aRecordKwInfo.value("isPelRequired", false);
 
-        types::BinaryVector l_srcBinaryValue;
-        std::string l_srcStrValue;
-        if (!io_srcVpdMap.empty())
-        {
-            l_srcStrValue = vpdSpecificUtility::getKwVal(
-                io_srcVpdMap.at(l_srcRecordName), l_srcKeywordName);
+        const types::BinaryVector l_srcBinaryValue = l_getKeywordValue(
+            io_srcVpdMap, l_srcDbusVpdMap, l_srcServiceName, l_srcInvPath,
+            l_srcRecordName, l_srcKeywordName);
 
-            if (l_srcStrValue.empty())
-            {
-                std::runtime_error(
-                    std::string("Failed to get value for keyword [") +
-                    l_srcKeywordName + std::string("]"));
-            }
-
-            l_srcBinaryValue =
-                types::BinaryVector(l_srcStrValue.begin(), l_srcStrValue.end());
-        }
-        else
-        {
-            // Read keyword value from DBus
-            const auto l_value = dbusUtility::readDbusProperty(
-                l_srcServiceName, l_srcInvPath,
-                constants::ipzVpdInf + l_srcRecordName, l_srcKeywordName);
-            if (const auto l_binaryValue =
-                    std::get_if<types::BinaryVector>(&l_value))
-            {
-                l_srcBinaryValue = *l_binaryValue;
-                l_srcStrValue = std::string(l_srcBinaryValue.begin(),
-                                            l_srcBinaryValue.end());
-            }
-        }
-
-        types::BinaryVector l_dstBinaryValue;
-        std::string l_dstStrValue;
-        if (!io_dstVpdMap.empty())
-        {
-            l_dstStrValue = vpdSpecificUtility::getKwVal(
-                io_dstVpdMap.at(l_dstRecordName), l_dstKeywordName);
-
-            if (l_dstStrValue.empty())
-            {
-                std::runtime_error(
-                    std::string("Failed to get value for keyword [") +
-                    l_dstKeywordName + std::string("]"));
-            }
-
-            l_dstBinaryValue =
-                types::BinaryVector(l_dstStrValue.begin(), l_dstStrValue.end());
-        }
-        else
-        {
-            // Read keyword value from DBus
-            const auto l_value = dbusUtility::readDbusProperty(
-                l_dstServiceName, l_dstInvPath,
-                constants::ipzVpdInf + l_dstRecordName, l_dstKeywordName);
-            if (const auto l_binaryValue =
-                    std::get_if<types::BinaryVector>(&l_value))
-            {
-                l_dstBinaryValue = *l_binaryValue;
-                l_dstStrValue = std::string(l_dstBinaryValue.begin(),
-                                            l_dstBinaryValue.end());
-            }
-        }
+        const types::BinaryVector l_dstBinaryValue = l_getKeywordValue(
+            io_dstVpdMap, l_dstDbusVpdMap, l_dstServiceName, l_dstInvPath,
+            l_dstRecordName, l_dstKeywordName);
 
         if (l_srcBinaryValue != l_dstBinaryValue)
         {
@@ -310,43 +312,15 @@ void BackupAndRestore::backupAndRestoreIpzVpd(
             // restore config JSON.
             if (l_dstBinaryValue == l_defaultBinaryValue)
             {
-                // Update keyword's value on hardware
-                auto l_vpdParser =
-                    std::make_shared<Parser>(l_dstFruPath, m_sysCfgJsonObj);
-
-                auto l_bytesUpdatedOnHardware = l_vpdParser->updateVpdKeyword(
-                    types::IpzData(l_dstRecordName, l_dstKeywordName,
-                                   l_srcBinaryValue));
-
-                /* To keep the data in sync between hardware and parsed map
-                 updating the io_dstVpdMap. This should only be done if write
-                 on hardware returns success.*/
-                if (!io_dstVpdMap.empty() && l_bytesUpdatedOnHardware > 0)
-                {
-                    io_dstVpdMap[l_dstRecordName][l_dstKeywordName] =
-                        l_srcStrValue;
-                }
+                l_dstUpdates.emplace_back(types::IpzData(
+                    l_dstRecordName, l_dstKeywordName, l_srcBinaryValue));
                 continue;
             }
 
             if (l_srcBinaryValue == l_defaultBinaryValue)
             {
-                // Update keyword's value on hardware
-                auto l_vpdParser =
-                    std::make_shared<Parser>(l_srcFruPath, m_sysCfgJsonObj);
-
-                auto l_bytesUpdatedOnHardware = l_vpdParser->updateVpdKeyword(
-                    types::IpzData(l_srcRecordName, l_srcKeywordName,
-                                   l_dstBinaryValue));
-
-                /* To keep the data in sync between hardware and parsed map
-                 updating the io_srcVpdMap. This should only be done if write
-                 on hardware returns success.*/
-                if (!io_srcVpdMap.empty() && l_bytesUpdatedOnHardware > 0)
-                {
-                    io_srcVpdMap[l_srcRecordName][l_srcKeywordName] =
-                        l_dstStrValue;
-                }
+                l_srcUpdates.emplace_back(types::IpzData(
+                    l_srcRecordName, l_srcKeywordName, l_dstBinaryValue));
             }
             else
             {
@@ -359,7 +333,8 @@ void BackupAndRestore::backupAndRestoreIpzVpd(
                 if (!io_srcVpdMap.empty() && io_dstVpdMap.empty())
                 {
                     io_srcVpdMap[l_srcRecordName][l_srcKeywordName] =
-                        l_dstStrValue;
+                        std::string(l_dstBinaryValue.begin(),
+                                    l_dstBinaryValue.end());
                 }
 
                 std::string l_errorMsg(
@@ -389,6 +364,42 @@ void BackupAndRestore::backupAndRestoreIpzVpd(
                 std::nullopt, std::nullopt, std::nullopt);
         }
     }
+
+    // Updates keywords on hardware as a single batch, and keeps the VPD map in
+    // sync with hardware for each keyword that got updated.
+    auto l_updateKeywords =
+        [this](const std::string& i_fruPath,
+               const std::vector<types::WriteVpdParams>& i_updates,
+               types::IPZVpdMap& io_vpdMap) {
+            if (i_updates.empty())
+            {
+                return;
+            }
+
+            auto l_vpdParser = std::make_shared<Parser>(
+                i_fruPath, m_sysCfgJsonObj, m_eepromWriteQueue);
+
+            const std::vector<int> l_bytesUpdatedOnHardware =
+                l_vpdParser->updateVpdKeywords(i_updates);
+
+            /* To keep the data in sync between hardware and parsed map
+             updating the io_vpdMap. This should only be done if write on
+             hardware returns success.*/
+            for (size_t l_index = 0; l_index < i_updates.size(); ++l_index)
+            {
+                const auto& [l_recordName, l_keywordName, l_value] =
+                    std::get<types::IpzData>(i_updates[l_index]);
+
+                if (!io_vpdMap.empty() && l_bytesUpdatedOnHardware[l_index] > 0)
+                {
+                    io_vpdMap[l_recordName][l_keywordName] =
+                        std::string(l_value.begin(), l_value.end());
+                }
+            }
+        };
+
+    l_updateKeywords(l_dstFruPath, l_dstUpdates, io_dstVpdMap);
+    l_updateKeywords(l_srcFruPath, l_srcUpdates, io_srcVpdMap);
 }
 
 void BackupAndRestore::setBackupAndRestoreStatus(
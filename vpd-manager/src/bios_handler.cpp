@@ -6,10 +6,16 @@
 #include "logger.hpp"
 
 #include <sdbusplus/bus/match.hpp>
+#include <systemd/sd-bus.h>
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
+#include <utility/vpd_specific_utility.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <string>
+#include <string_view>
 
 namespace vpd
 {
@@ -87,115 +93,425 @@ void IbmBiosHandler::biosAttributesCallback(sdbusplus::message_t& i_msg)
         return;
     }
 
-    std::string l_objPath;
-    types::BiosBaseTableType l_propMap;
-    i_msg.read(l_objPath, l_propMap);
+    types::BiosAttributeValueMap l_attributes;
+    try
+    {
+        l_attributes = decodeBiosAttributes(i_msg);
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Invalid type received for BIOS table. " +
+                            std::string(l_ex.what()));
+        EventLogger::createSyncPel(
+            types::ErrorType::FirmwareError, types::SeverityType::Warning,
+            __FILE__, __FUNCTION__, 0,
+            std::string("Invalid type received for BIOS table."), std::nullopt,
+            std::nullopt, std::nullopt, std::nullopt);
+        return;
+    }
+
+    // Seen value is updated only once it makes it to VPD, so that a failed
+    // sync is retried on next change signal. An attribute changed back to its
+    // seen value is dropped from the pending changes.
+    vpdSpecificUtility::updatePendingBiosAttributes(
+        m_lastSeenAttributes, l_attributes, m_changedAttributes);
 
-    for (auto l_property : l_propMap)
+    if (m_changedAttributes.empty())
     {
-        if (l_property.first != "BaseBIOSTable")
+        return;
+    }
+
+    // (Re)start the quiet period, sync happens once changes settle.
+    m_debouncer.trigger([this]() { syncChangedAttributesToVpd(); });
+}
+
+types::BiosAttributeValueMap IbmBiosHandler::decodeBiosAttributes(
+    sdbusplus::message_t& i_msg)
+{
+    types::BiosAttributeValueMap l_attributes;
+    sd_bus_message* l_msg = i_msg.get();
+
+    auto l_checkRc = [](int i_rc, const std::string& i_step) {
+        if (i_rc < 0)
+        {
+            throw std::runtime_error("Failed to " + i_step + ", error: " +
+                                     std::string(std::strerror(-i_rc)));
+        }
+        return i_rc;
+    };
+
+    // Interface name is known as match is on BIOS config manager interface.
+    l_checkRc(sd_bus_message_skip(l_msg, "s"), "skip interface name");
+
+    l_checkRc(sd_bus_message_enter_container(l_msg, SD_BUS_TYPE_ARRAY, "{sv}"),
+              "enter changed properties");
+
+    while (l_checkRc(sd_bus_message_enter_container(
+                         l_msg, SD_BUS_TYPE_DICT_ENTRY, "sv"),
+                     "enter property") > 0)
+    {
+        const char* l_property = nullptr;
+        l_checkRc(
+            sd_bus_message_read_basic(l_msg, SD_BUS_TYPE_STRING, &l_property),
+            "read property name");
+
+        if (std::string_view(l_property) != "BaseBIOSTable")
         {
             // Looking for change in Base BIOS table only.
+            l_checkRc(sd_bus_message_skip(l_msg, "v"), "skip property");
+            l_checkRc(sd_bus_message_exit_container(l_msg), "exit property");
             continue;
         }
 
-        if (auto l_attributeList =
-                std::get_if<std::map<std::string, types::BiosProperty>>(
-                    &(l_property.second)))
+        l_checkRc(sd_bus_message_enter_container(l_msg, SD_BUS_TYPE_VARIANT,
+                                                 "a{s(sbsssvva(svs))}"),
+                  "enter BIOS table");
+        l_checkRc(sd_bus_message_enter_container(l_msg, SD_BUS_TYPE_ARRAY,
+                                                 "{s(sbsssvva(svs))}"),
+                  "enter BIOS attribute list");
+
+        while (l_checkRc(sd_bus_message_enter_container(
+                             l_msg, SD_BUS_TYPE_DICT_ENTRY, "s(sbsssvva(svs))"),
+                         "enter BIOS attribute") > 0)
         {
-            for (const auto& l_attribute : *l_attributeList)
+            const char* l_attributeName = nullptr;
+            l_checkRc(sd_bus_message_read_basic(l_msg, SD_BUS_TYPE_STRING,
+                                                &l_attributeName),
+                      "read BIOS attribute name");
+
+            if (std::find(m_biosAttributes.cbegin(), m_biosAttributes.cend(),
+                          l_attributeName) == m_biosAttributes.cend())
             {
-                if (auto l_val = std::get_if<std::string>(
-                        &(std::get<5>(std::get<1>(l_attribute)))))
-                {
-                    std::string l_attributeName = std::get<0>(l_attribute);
-                    if (l_attributeName == "hb_memory_mirror_mode")
-                    {
-                        saveAmmToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_keep_and_clear")
-                    {
-                        saveKeepAndClearToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_create_default_lpar")
-                    {
-                        saveCreateDefaultLparToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_clear_nvram")
-                    {
-                        saveClearNvramToVpd(*l_val);
-                    }
-
-                    continue;
-                }
+                // Not backed up in VPD, skip without decoding.
+                l_checkRc(sd_bus_message_skip(l_msg, "(sbsssvva(svs))"),
+                          "skip BIOS attribute");
+                l_checkRc(sd_bus_message_exit_container(l_msg),
+                          "exit BIOS attribute");
+                continue;
+            }
 
-                if (auto l_val = std::get_if<int64_t>(
-                        &(std::get<5>(std::get<1>(l_attribute)))))
-                {
-                    std::string l_attributeName = std::get<0>(l_attribute);
-                    if (l_attributeName == "hb_field_core_override")
-                    {
-                        saveFcoToVpd(*l_val);
-                    }
-                }
+            l_checkRc(sd_bus_message_enter_container(
+                          l_msg, SD_BUS_TYPE_STRUCT, "sbsssvva(svs)"),
+                      "enter BIOS property");
+
+            // Skip till current value.
+            l_checkRc(sd_bus_message_skip(l_msg, "sbsss"),
+                      "skip BIOS property fields");
+
+            char l_type = 0;
+            const char* l_contents = nullptr;
+            l_checkRc(sd_bus_message_peek_type(l_msg, &l_type, &l_contents),
+                      "peek current value type");
+            l_checkRc(sd_bus_message_enter_container(
+                          l_msg, SD_BUS_TYPE_VARIANT, l_contents),
+                      "enter current value");
+
+            if (std::string_view(l_contents) == "x")
+            {
+                int64_t l_value = 0;
+                l_checkRc(
+                    sd_bus_message_read_basic(l_msg, SD_BUS_TYPE_INT64,
+                                              &l_value),
+                    "read current value");
+                l_attributes.emplace(l_attributeName, l_value);
+            }
+            else if (std::string_view(l_contents) == "s")
+            {
+                const char* l_value = nullptr;
+                l_checkRc(
+                    sd_bus_message_read_basic(l_msg, SD_BUS_TYPE_STRING,
+                                              &l_value),
+                    "read current value");
+                l_attributes.emplace(l_attributeName, std::string(l_value));
+            }
+            else
+            {
+                l_checkRc(sd_bus_message_skip(l_msg, l_contents),
+                          "skip current value");
             }
+
+            l_checkRc(sd_bus_message_exit_container(l_msg),
+                      "exit current value");
+
+            // Skip pending value and value list.
+            l_checkRc(sd_bus_message_skip(l_msg, "va(svs)"),
+                      "skip BIOS property fields");
+            l_checkRc(sd_bus_message_exit_container(l_msg),
+                      "exit BIOS property");
+            l_checkRc(sd_bus_message_exit_container(l_msg),
+                      "exit BIOS attribute");
         }
-        else
+
+        l_checkRc(sd_bus_message_exit_container(l_msg),
+                  "exit BIOS attribute list");
+        l_checkRc(sd_bus_message_exit_container(l_msg), "exit BIOS table");
+        l_checkRc(sd_bus_message_exit_container(l_msg), "exit property");
+    }
+
+    l_checkRc(sd_bus_message_exit_container(l_msg), "exit changed properties");
+    return l_attributes;
+}
+
+void IbmBiosHandler::syncChangedAttributesToVpd()
+{
+    types::BiosAttributeValueMap l_changedAttributes;
+    l_changedAttributes.swap(m_changedAttributes);
+
+    if (l_changedAttributes.empty())
+    {
+        return;
+    }
+
+    // Read keywords backing the attributes once, all changed attributes are
+    // applied on a copy and written back in one batch.
+    const types::IpzTypeValueMap l_vpdKeywords = readBiosKeywordsFromVpd();
+    types::IpzTypeValueMap l_updatedKeywords = l_vpdKeywords;
+
+    // Keywords each attribute needs to be updated in VPD.
+    std::map<std::string, std::set<types::IpzType>> l_attributeKeywords;
+
+    for (const auto& [l_attributeName, l_value] : l_changedAttributes)
+    {
+        const types::IpzTypeValueMap l_keywordsBefore = l_updatedKeywords;
+
+        saveAttributeToVpd(l_attributeName, l_value, l_updatedKeywords);
+
+        l_attributeKeywords[l_attributeName] =
+            vpdSpecificUtility::getChangedKeywords(l_keywordsBefore,
+                                                   l_updatedKeywords);
+    }
+
+    const std::set<types::IpzType> l_failedKeywords =
+        writeBiosKeywordsToVpd(l_vpdKeywords, l_updatedKeywords);
+
+    // Attributes whose keywords failed to update are not marked seen, so that
+    // they are synced again on next change signal.
+    for (const auto& [l_attributeName, l_value] : l_changedAttributes)
+    {
+        const auto l_itrToKeywords = l_attributeKeywords.find(l_attributeName);
+        if (l_itrToKeywords != l_attributeKeywords.end() &&
+            std::ranges::any_of(l_itrToKeywords->second,
+                                [&l_failedKeywords](const auto& i_keyword) {
+                                    return l_failedKeywords.contains(i_keyword);
+                                }))
         {
-            logging::logMessage("Invalid type received for BIOS table.");
-            EventLogger::createSyncPel(
-                types::ErrorType::FirmwareError, types::SeverityType::Warning,
-                __FILE__, __FUNCTION__, 0,
-                std::string("Invalid type received for BIOS table."),
-                std::nullopt, std::nullopt, std::nullopt, std::nullopt);
-            break;
+            continue;
+        }
+
+        m_lastSeenAttributes[l_attributeName] = l_value;
+    }
+}
+
+void IbmBiosHandler::saveAttributeToVpd(
+    const std::string& i_attributeName,
+    const types::BiosAttributeCurrentValue& i_value,
+    types::IpzTypeValueMap& io_keywords)
+{
+    if (auto l_val = std::get_if<std::string>(&i_value))
+    {
+        if (i_attributeName == "hb_memory_mirror_mode")
+        {
+            saveAmmToVpd(*l_val, io_keywords);
+        }
+
+        if (i_attributeName == "pvm_keep_and_clear")
+        {
+            saveKeepAndClearToVpd(*l_val, io_keywords);
+        }
+
+        if (i_attributeName == "pvm_create_default_lpar")
+        {
+            saveCreateDefaultLparToVpd(*l_val, io_keywords);
+        }
+
+        if (i_attributeName == "pvm_clear_nvram")
+        {
+            saveClearNvramToVpd(*l_val, io_keywords);
+        }
+
+        return;
+    }
+
+    if (auto l_val = std::get_if<int64_t>(&i_value))
+    {
+        if (i_attributeName == "hb_field_core_override")
+        {
+            saveFcoToVpd(*l_val, io_keywords);
         }
     }
 }
 
 void IbmBiosHandler::backUpOrRestoreBiosAttributes()
 {
+    // Read all the keywords and attributes to be synced in one pass.
+    const types::IpzTypeValueMap l_vpdKeywords = readBiosKeywordsFromVpd();
+    const types::BiosAttributeValueMap l_biosAttributes =
+        dbusUtility::biosGetAttributesFromBaseTable(m_biosAttributes);
+
+    // Baseline for detecting change in attributes.
+    m_lastSeenAttributes = l_biosAttributes;
+
+    // Reconciled state, to be written to VPD and BIOS.
+    types::IpzTypeValueMap l_updatedKeywords = l_vpdKeywords;
+    types::PendingBIOSAttrs l_pendingAttributes;
+
     // process FCO
-    processFieldCoreOverride();
+    processFieldCoreOverride(l_biosAttributes, l_updatedKeywords,
+                             l_pendingAttributes);
 
     // process AMM
-    processActiveMemoryMirror();
+    processActiveMemoryMirror(l_biosAttributes, l_updatedKeywords,
+                              l_pendingAttributes);
 
     // process LPAR
-    processCreateDefaultLpar();
+    processCreateDefaultLpar(l_vpdKeywords, l_pendingAttributes);
 
     // process clear NVRAM
-    processClearNvram();
+    processClearNvram(l_vpdKeywords, l_pendingAttributes);
 
     // process keep and clear
-    processKeepAndClear();
+    processKeepAndClear(l_vpdKeywords, l_pendingAttributes);
+
+    writeBiosKeywordsToVpd(l_vpdKeywords, l_updatedKeywords);
+    writePendingAttributesToBios(l_pendingAttributes);
+}
+
+types::IpzTypeValueMap IbmBiosHandler::readBiosKeywordsFromVpd()
+{
+    // Interface, record and keywords backing the BIOS attributes.
+    static const std::vector<
+        std::tuple<std::string, std::string, std::vector<std::string>>>
+        l_biosKeywords{{constants::utilInf,
+                        "UTIL",
+                        {constants::kwdAMM, constants::kwdClearNVRAM_CreateLPAR,
+                         constants::kwdKeepAndClear}},
+                       {constants::vsysInf, "VSYS", {constants::kwdRG}}};
+
+    types::IpzTypeValueMap l_vpdKeywords;
+    for (const auto& [l_interface, l_record, l_keywords] : l_biosKeywords)
+    {
+        const types::PropertyMap l_propertyMap = dbusUtility::getPropertyMap(
+            constants::pimServiceName, constants::systemVpdInvPath,
+            l_interface);
+
+        for (const auto& l_keyword : l_keywords)
+        {
+            const auto l_itrToKeyword = l_propertyMap.find(l_keyword);
+            if (l_itrToKeyword == l_propertyMap.end())
+            {
+                continue;
+            }
+
+            if (const auto l_value = std::get_if<types::BinaryVector>(
+                    &(l_itrToKeyword->second)))
+            {
+                l_vpdKeywords.emplace(types::IpzType(l_record, l_keyword),
+                                      *l_value);
+            }
+        }
+    }
+    return l_vpdKeywords;
+}
+
+std::set<types::IpzType> IbmBiosHandler::writeBiosKeywordsToVpd(
+    const types::IpzTypeValueMap& i_vpdKeywords,
+    const types::IpzTypeValueMap& i_updatedKeywords)
+{
+    std::set<types::IpzType> l_failedKeywords;
+
+    // Keywords with value same as in VPD need no update.
+    std::vector<types::WriteVpdParams> l_paramsToWriteData;
+    for (const auto& l_recordKeyword :
+         vpdSpecificUtility::getChangedKeywords(i_vpdKeywords,
+                                                i_updatedKeywords))
+    {
+        l_paramsToWriteData.emplace_back(types::IpzData(
+            std::get<0>(l_recordKeyword), std::get<1>(l_recordKeyword),
+            i_updatedKeywords.at(l_recordKeyword)));
+    }
+
+    if (l_paramsToWriteData.empty())
+    {
+        return l_failedKeywords;
+    }
+
+    // Each keyword is reported on its own, failure of one doesn't fail the
+    // keywords which got updated alongside. Written in order with D-Bus method
+    // tasks on system VPD.
+    const std::vector<int> l_results = m_manager->runOnEepromStrand(
+        SYSTEM_VPD_FILE_PATH, [this, &l_paramsToWriteData]() {
+            return m_manager->updateKeywords(SYSTEM_VPD_FILE_PATH,
+                                             l_paramsToWriteData);
+        });
+
+    for (size_t l_index = 0; l_index < l_results.size(); ++l_index)
+    {
+        if (l_results[l_index] == constants::FAILURE)
+        {
+            const auto& l_ipzData =
+                std::get<types::IpzData>(l_paramsToWriteData[l_index]);
+            logging::logMessage("Failed to update " +
+                                std::get<1>(l_ipzData) + " keyword to VPD");
+
+            l_failedKeywords.emplace(std::get<0>(l_ipzData),
+                                     std::get<1>(l_ipzData));
+        }
+    }
+    return l_failedKeywords;
+}
+
+void IbmBiosHandler::writePendingAttributesToBios(
+    const types::PendingBIOSAttrs& i_pendingAttributes)
+{
+    if (i_pendingAttributes.empty())
+    {
+        return;
+    }
+
+    if (!dbusUtility::writeDbusProperty(
+            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
+            constants::biosConfigMgrInterface, "PendingAttributes",
+            i_pendingAttributes))
+    {
+        // TODO: Should we log informational PEL here as well?
+        logging::logMessage(
+            "DBus call to update BIOS attributes in pending attribute failed.");
+    }
 }
 
 types::BiosAttributeCurrentValue IbmBiosHandler::readBiosAttribute(
-    const std::string& i_attributeName)
+    const std::string& i_attributeName,
+    const types::BiosAttributeValueMap& i_biosAttributes)
 {
+    const auto l_itrToAttribute = i_biosAttributes.find(i_attributeName);
+    if (l_itrToAttribute != i_biosAttributes.end())
+    {
+        return l_itrToAttribute->second;
+    }
+
+    // Not found in base table, read the attribute individually.
     types::BiosAttributeCurrentValue l_attrValueVariant =
         dbusUtility::biosGetAttributeMethodCall(i_attributeName);
 
     return l_attrValueVariant;
 }
 
-void IbmBiosHandler::processFieldCoreOverride()
+void IbmBiosHandler::processFieldCoreOverride(
+    const types::BiosAttributeValueMap& i_biosAttributes,
+    types::IpzTypeValueMap& io_vpdKeywords,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
     // TODO: Should we avoid doing this at runtime?
 
-    // Read required keyword from Dbus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdRG);
+    const auto l_itrToKeyword =
+        io_vpdKeywords.find(types::IpzType("VSYS", constants::kwdRG));
 
-    if (auto l_fcoInVpd = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
+        const types::BinaryVector l_fcoInVpd = l_itrToKeyword->second;
+
         // default length of the keyword is 4 bytes.
-        if (l_fcoInVpd->size() != constants::VALUE_4)
+        if (l_fcoInVpd.size() != constants::VALUE_4)
         {
             logging::logMessage(
                 "Invalid value read for FCO from D-Bus. Skipping.");
@@ -203,23 +519,23 @@ void IbmBiosHandler::processFieldCoreOverride()
 
         //  If FCO in VPD contains anything other that ASCII Space, restore to
         //  BIOS
-        if (std::any_of(l_fcoInVpd->cbegin(), l_fcoInVpd->cend(),
+        if (std::any_of(l_fcoInVpd.cbegin(), l_fcoInVpd.cend(),
                         [](uint8_t l_val) {
                             return l_val != constants::ASCII_OF_SPACE;
                         }))
         {
             // Restore the data to BIOS.
-            saveFcoToBios(*l_fcoInVpd);
+            saveFcoToBios(l_fcoInVpd, io_pendingAttributes);
         }
         else
         {
             types::BiosAttributeCurrentValue l_attrValueVariant =
-                readBiosAttribute("hb_field_core_override");
+                readBiosAttribute("hb_field_core_override", i_biosAttributes);
 
             if (auto l_fcoInBios = std::get_if<int64_t>(&l_attrValueVariant))
             {
                 // save the BIOS data to VPD
-                saveFcoToVpd(*l_fcoInBios);
+                saveFcoToVpd(*l_fcoInBios, io_vpdKeywords);
 
                 return;
             }
@@ -230,7 +546,8 @@ void IbmBiosHandler::processFieldCoreOverride()
     logging::logMessage("Invalid type recieved for FCO from VPD.");
 }
 
-void IbmBiosHandler::saveFcoToVpd(int64_t i_fcoInBios)
+void IbmBiosHandler::saveFcoToVpd(int64_t i_fcoInBios,
+                                  types::IpzTypeValueMap& io_vpdKeywords)
 {
     if (i_fcoInBios < 0)
     {
@@ -238,40 +555,23 @@ void IbmBiosHandler::saveFcoToVpd(int64_t i_fcoInBios)
         return;
     }
 
-    // Read required keyword from Dbus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdRG);
+    auto l_itrToKeyword =
+        io_vpdKeywords.find(types::IpzType("VSYS", constants::kwdRG));
 
-    if (auto l_fcoInVpd = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
+        types::BinaryVector& l_fcoInVpd = l_itrToKeyword->second;
+
         // default length of the keyword is 4 bytes.
-        if (l_fcoInVpd->size() != constants::VALUE_4)
+        if (l_fcoInVpd.size() != constants::VALUE_4)
         {
             logging::logMessage(
                 "Invalid value read for FCO from D-Bus. Skipping.");
             return;
         }
 
-        // convert to VPD value type
-        types::BinaryVector l_biosValInVpdFormat = {
-            0, 0, 0, static_cast<uint8_t>(i_fcoInBios)};
-
-        // Update only when the data are different.
-        if (std::memcmp(l_biosValInVpdFormat.data(), l_fcoInVpd->data(),
-                        constants::VALUE_4) != constants::SUCCESS)
-        {
-            if (constants::FAILURE ==
-                m_manager->updateKeyword(
-                    SYSTEM_VPD_FILE_PATH,
-                    types::IpzData("VSYS", constants::kwdRG,
-                                   l_biosValInVpdFormat)))
-            {
-                logging::logMessage(
-                    "Failed to update " + std::string(constants::kwdRG) +
-                    " keyword to VPD.");
-            }
-        }
+        // convert to VPD value type, gets written only if different from VPD.
+        l_fcoInVpd = {0, 0, 0, static_cast<uint8_t>(i_fcoInBios)};
     }
     else
     {
@@ -279,7 +579,9 @@ void IbmBiosHandler::saveFcoToVpd(int64_t i_fcoInBios)
     }
 }
 
-void IbmBiosHandler::saveFcoToBios(const types::BinaryVector& i_fcoVal)
+void IbmBiosHandler::saveFcoToBios(
+    const types::BinaryVector& i_fcoVal,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
     if (i_fcoVal.size() != constants::VALUE_4)
     {
@@ -287,25 +589,15 @@ void IbmBiosHandler::saveFcoToBios(const types::BinaryVector& i_fcoVal)
         return;
     }
 
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
+    io_pendingAttributes.push_back(std::make_pair(
         "hb_field_core_override",
         std::make_tuple(
             "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Integer",
             i_fcoVal.at(constants::VALUE_3))));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        // TODO: Should we log informational PEL here as well?
-        logging::logMessage(
-            "DBus call to update FCO value in pending attribute failed. ");
-    }
 }
 
-void IbmBiosHandler::saveAmmToVpd(const std::string& i_memoryMirrorMode)
+void IbmBiosHandler::saveAmmToVpd(const std::string& i_memoryMirrorMode,
+                                  types::IpzTypeValueMap& io_vpdKeywords)
 {
     if (i_memoryMirrorMode.empty())
     {
@@ -314,33 +606,19 @@ void IbmBiosHandler::saveAmmToVpd(const std::string& i_memoryMirrorMode)
         return;
     }
 
-    // Read existing value.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdAMM);
+    auto l_itrToKeyword =
+        io_vpdKeywords.find(types::IpzType("UTIL", constants::kwdAMM));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
-        auto l_ammValInVpd = *l_pVal;
-
         types::BinaryVector l_valToUpdateInVpd{
             (i_memoryMirrorMode == "Enabled" ? constants::AMM_ENABLED_IN_VPD
                                              : constants::AMM_DISABLED_IN_VPD)};
 
         // Check if value is already updated on VPD.
-        if (l_ammValInVpd.at(0) == l_valToUpdateInVpd.at(0))
+        if (l_itrToKeyword->second.at(0) != l_valToUpdateInVpd.at(0))
         {
-            return;
-        }
-
-        if (constants::FAILURE ==
-            m_manager->updateKeyword(
-                SYSTEM_VPD_FILE_PATH,
-                types::IpzData("UTIL", constants::kwdAMM, l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " + std::string(constants::kwdAMM) +
-                " keyword to VPD");
+            l_itrToKeyword->second = l_valToUpdateInVpd;
         }
     }
     else
@@ -351,48 +629,40 @@ void IbmBiosHandler::saveAmmToVpd(const std::string& i_memoryMirrorMode)
     }
 }
 
-void IbmBiosHandler::saveAmmToBios(const uint8_t& i_ammVal)
+void IbmBiosHandler::saveAmmToBios(
+    const uint8_t& i_ammVal, types::PendingBIOSAttrs& io_pendingAttributes)
 {
     const std::string l_valtoUpdate =
         (i_ammVal == constants::VALUE_2) ? "Enabled" : "Disabled";
 
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
+    io_pendingAttributes.push_back(std::make_pair(
         "hb_memory_mirror_mode",
         std::make_tuple(
             "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
             l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        // TODO: Should we log informational PEL here as well?
-        logging::logMessage(
-            "DBus call to update AMM value in pending attribute failed.");
-    }
 }
 
-void IbmBiosHandler::processActiveMemoryMirror()
+void IbmBiosHandler::processActiveMemoryMirror(
+    const types::BiosAttributeValueMap& i_biosAttributes,
+    types::IpzTypeValueMap& io_vpdKeywords,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdAMM);
+    const auto l_itrToKeyword =
+        io_vpdKeywords.find(types::IpzType("UTIL", constants::kwdAMM));
 
-    if (auto pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
-        auto l_ammValInVpd = *pVal;
+        const uint8_t l_ammValInVpd = l_itrToKeyword->second.at(0);
 
         // Check if active memory mirror value is default in VPD.
-        if (l_ammValInVpd.at(0) == constants::VALUE_0)
+        if (l_ammValInVpd == constants::VALUE_0)
         {
             types::BiosAttributeCurrentValue l_attrValueVariant =
-                readBiosAttribute("hb_memory_mirror_mode");
+                readBiosAttribute("hb_memory_mirror_mode", i_biosAttributes);
 
             if (auto pVal = std::get_if<std::string>(&l_attrValueVariant))
             {
-                saveAmmToVpd(*pVal);
+                saveAmmToVpd(*pVal, io_vpdKeywords);
                 return;
             }
             logging::logMessage(
@@ -401,7 +671,7 @@ void IbmBiosHandler::processActiveMemoryMirror()
         }
         else
         {
-            saveAmmToBios(l_ammValInVpd.at(0));
+            saveAmmToBios(l_ammValInVpd, io_pendingAttributes);
         }
         return;
     }
@@ -410,7 +680,8 @@ void IbmBiosHandler::processActiveMemoryMirror()
 }
 
 void IbmBiosHandler::saveCreateDefaultLparToVpd(
-    const std::string& i_createDefaultLparVal)
+    const std::string& i_createDefaultLparVal,
+    types::IpzTypeValueMap& io_vpdKeywords)
 {
     if (i_createDefaultLparVal.empty())
     {
@@ -419,53 +690,28 @@ void IbmBiosHandler::saveCreateDefaultLparToVpd(
         return;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdClearNVRAM_CreateLPAR);
+    // Keyword is shared with other attributes, we need to set only a Bit.
+    auto l_itrToKeyword = io_vpdKeywords.find(
+        types::IpzType("UTIL", constants::kwdClearNVRAM_CreateLPAR));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
+        types::BinaryVector& l_kwdValue = l_itrToKeyword->second;
+
         commonUtility::toLower(
             const_cast<std::string&>(i_createDefaultLparVal));
 
-        // Check for second bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x02) == 0x02) &&
-             (i_createDefaultLparVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x02) == 0x00) &&
-             (i_createDefaultLparVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
-        {
-            // Values are same, Don;t update.
-            return;
-        }
-
-        types::BinaryVector l_valToUpdateInVpd;
+        // 2nd Bit is used to store the value, gets written only if different
+        // from VPD.
         if (i_createDefaultLparVal.compare("enabled") ==
             constants::STR_CMP_SUCCESS)
         {
-            // 2nd Bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back((*l_pVal).at(0) | 0x02);
+            l_kwdValue.at(0) |= 0x02;
         }
         else
         {
-            // 2nd Bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back((*l_pVal).at(0) & ~(0x02));
-        }
-
-        if (-1 ==
-            m_manager->updateKeyword(
-                SYSTEM_VPD_FILE_PATH,
-                types::IpzData("UTIL", constants::kwdClearNVRAM_CreateLPAR,
-                               l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " +
-                std::string(constants::kwdClearNVRAM_CreateLPAR) +
-                " keyword to VPD");
+            l_kwdValue.at(0) &= ~(0x02);
         }
-
         return;
     }
     logging::logMessage(
@@ -473,7 +719,8 @@ void IbmBiosHandler::saveCreateDefaultLparToVpd(
 }
 
 void IbmBiosHandler::saveCreateDefaultLparToBios(
-    const std::string& i_createDefaultLparVal)
+    const std::string& i_createDefaultLparVal,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
     // checking for exact length as it is a string and can have garbage value.
     if (i_createDefaultLparVal.size() != constants::VALUE_1)
@@ -486,42 +733,33 @@ void IbmBiosHandler::saveCreateDefaultLparToBios(
     std::string l_valtoUpdate =
         (i_createDefaultLparVal.at(0) & 0x02) ? "Enabled" : "Disabled";
 
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
+    io_pendingAttributes.push_back(std::make_pair(
         "pvm_create_default_lpar",
         std::make_tuple(
             "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
             l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        logging::logMessage(
-            "DBus call to update lpar value in pending attribute failed.");
-    }
-
-    return;
 }
 
-void IbmBiosHandler::processCreateDefaultLpar()
+void IbmBiosHandler::processCreateDefaultLpar(
+    const types::IpzTypeValueMap& i_vpdKeywords,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
-    // Read required keyword from DBus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdClearNVRAM_CreateLPAR);
+    const auto l_itrToKeyword = i_vpdKeywords.find(
+        types::IpzType("UTIL", constants::kwdClearNVRAM_CreateLPAR));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != i_vpdKeywords.end())
     {
-        saveCreateDefaultLparToBios(std::to_string(l_pVal->at(0)));
+        saveCreateDefaultLparToBios(
+            std::to_string(l_itrToKeyword->second.at(0)),
+            io_pendingAttributes);
         return;
     }
     logging::logMessage(
         "Invalid type recieved for create default Lpar from VPD.");
 }
 
-void IbmBiosHandler::saveClearNvramToVpd(const std::string& i_clearNvramVal)
+void IbmBiosHandler::saveClearNvramToVpd(const std::string& i_clearNvramVal,
+                                         types::IpzTypeValueMap& io_vpdKeywords)
 {
     if (i_clearNvramVal.empty())
     {
@@ -530,59 +768,34 @@ void IbmBiosHandler::saveClearNvramToVpd(const std::string& i_clearNvramVal)
         return;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdClearNVRAM_CreateLPAR);
+    // Keyword is shared with other attributes, we need to set only a Bit.
+    auto l_itrToKeyword = io_vpdKeywords.find(
+        types::IpzType("UTIL", constants::kwdClearNVRAM_CreateLPAR));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
-        commonUtility::toLower(const_cast<std::string&>(i_clearNvramVal));
+        types::BinaryVector& l_kwdValue = l_itrToKeyword->second;
 
-        // Check for third bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x04) == 0x04) &&
-             (i_clearNvramVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x04) == 0x00) &&
-             (i_clearNvramVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
-        {
-            // Don't update, values are same.
-            return;
-        }
+        commonUtility::toLower(const_cast<std::string&>(i_clearNvramVal));
 
-        types::BinaryVector l_valToUpdateInVpd;
+        // 3rd bit is used to store the value, gets written only if different
+        // from VPD.
         if (i_clearNvramVal.compare("enabled") == constants::STR_CMP_SUCCESS)
         {
-            // 3rd bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) | constants::VALUE_4);
+            l_kwdValue.at(0) |= constants::VALUE_4;
         }
         else
         {
-            // 3rd bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) & ~(constants::VALUE_4));
+            l_kwdValue.at(0) &= ~(constants::VALUE_4);
         }
-
-        if (-1 ==
-            m_manager->updateKeyword(
-                SYSTEM_VPD_FILE_PATH,
-                types::IpzData("UTIL", constants::kwdClearNVRAM_CreateLPAR,
-                               l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " +
-                std::string(constants::kwdClearNVRAM_CreateLPAR) +
-                " keyword to VPD");
-        }
-
         return;
     }
     logging::logMessage("Invalid type recieved for clear NVRAM from VPD.");
 }
 
-void IbmBiosHandler::saveClearNvramToBios(const std::string& i_clearNvramVal)
+void IbmBiosHandler::saveClearNvramToBios(
+    const std::string& i_clearNvramVal,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
     // Check for the exact length as it is a string and it can have a garbage
     // value.
@@ -597,39 +810,32 @@ void IbmBiosHandler::saveClearNvramToBios(const std::string& i_clearNvramVal)
     std::string l_valtoUpdate =
         (i_clearNvramVal.at(0) & constants::VALUE_4) ? "Enabled" : "Disabled";
 
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
+    io_pendingAttributes.push_back(std::make_pair(
         "pvm_clear_nvram",
         std::make_tuple(
             "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
             l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        logging::logMessage(
-            "DBus call to update NVRAM value in pending attribute failed.");
-    }
 }
 
-void IbmBiosHandler::processClearNvram()
+void IbmBiosHandler::processClearNvram(
+    const types::IpzTypeValueMap& i_vpdKeywords,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
-    // Read required keyword from VPD.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdClearNVRAM_CreateLPAR);
+    const auto l_itrToKeyword = i_vpdKeywords.find(
+        types::IpzType("UTIL", constants::kwdClearNVRAM_CreateLPAR));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != i_vpdKeywords.end())
     {
-        saveClearNvramToBios(std::to_string(l_pVal->at(0)));
+        saveClearNvramToBios(std::to_string(l_itrToKeyword->second.at(0)),
+                             io_pendingAttributes);
         return;
     }
     logging::logMessage("Invalid type recieved for clear NVRAM from VPD.");
 }
 
-void IbmBiosHandler::saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal)
+void IbmBiosHandler::saveKeepAndClearToVpd(
+    const std::string& i_KeepAndClearVal,
+    types::IpzTypeValueMap& io_vpdKeywords)
 {
     if (i_KeepAndClearVal.empty())
     {
@@ -638,58 +844,34 @@ void IbmBiosHandler::saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal)
         return;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdKeepAndClear);
+    // Keyword is shared with other attributes, we need to set only a Bit.
+    auto l_itrToKeyword = io_vpdKeywords.find(
+        types::IpzType("UTIL", constants::kwdKeepAndClear));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != io_vpdKeywords.end())
     {
-        commonUtility::toLower(const_cast<std::string&>(i_KeepAndClearVal));
+        types::BinaryVector& l_kwdValue = l_itrToKeyword->second;
 
-        // Check for first bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x01) == 0x01) &&
-             (i_KeepAndClearVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x01) == 0x00) &&
-             (i_KeepAndClearVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
-        {
-            // Don't update, values are same.
-            return;
-        }
+        commonUtility::toLower(const_cast<std::string&>(i_KeepAndClearVal));
 
-        types::BinaryVector l_valToUpdateInVpd;
+        // 1st bit is used to store the value, gets written only if different
+        // from VPD.
         if (i_KeepAndClearVal.compare("enabled") == constants::STR_CMP_SUCCESS)
         {
-            // 1st bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) | constants::VALUE_1);
+            l_kwdValue.at(0) |= constants::VALUE_1;
         }
         else
         {
-            // 1st bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) & ~(constants::VALUE_1));
+            l_kwdValue.at(0) &= ~(constants::VALUE_1);
         }
-
-        if (-1 == m_manager->updateKeyword(
-                      SYSTEM_VPD_FILE_PATH,
-                      types::IpzData("UTIL", constants::kwdKeepAndClear,
-                                     l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " + std::string(constants::kwdKeepAndClear) +
-                " keyword to VPD");
-        }
-
         return;
     }
     logging::logMessage("Invalid type recieved for keep and clear from VPD.");
 }
 
 void IbmBiosHandler::saveKeepAndClearToBios(
-    const std::string& i_KeepAndClearVal)
+    const std::string& i_KeepAndClearVal,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
     // checking for exact length as it is a string and can have garbage value.
     if (i_KeepAndClearVal.size() != constants::VALUE_1)
@@ -703,33 +885,24 @@ void IbmBiosHandler::saveKeepAndClearToBios(
     std::string l_valtoUpdate =
         (i_KeepAndClearVal.at(0) & constants::VALUE_1) ? "Enabled" : "Disabled";
 
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
+    io_pendingAttributes.push_back(std::make_pair(
         "pvm_keep_and_clear",
         std::make_tuple(
             "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
             l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        logging::logMessage(
-            "DBus call to update keep and clear value in pending attribute failed.");
-    }
 }
 
-void IbmBiosHandler::processKeepAndClear()
+void IbmBiosHandler::processKeepAndClear(
+    const types::IpzTypeValueMap& i_vpdKeywords,
+    types::PendingBIOSAttrs& io_pendingAttributes)
 {
-    // Read required keyword from VPD.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::utilInf, constants::kwdKeepAndClear);
+    const auto l_itrToKeyword =
+        i_vpdKeywords.find(types::IpzType("UTIL", constants::kwdKeepAndClear));
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (l_itrToKeyword != i_vpdKeywords.end())
     {
-        saveKeepAndClearToBios(std::to_string(l_pVal->at(0)));
+        saveKeepAndClearToBios(std::to_string(l_itrToKeyword->second.at(0)),
+                               io_pendingAttributes);
         return;
     }
     logging::logMessage("Invalid type recieved for keep and clear from VPD.");
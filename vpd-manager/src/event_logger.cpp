@@ -1,12 +1,207 @@
 #include "event_logger.hpp"
 
+#include "bounded_queue.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
 
+#include <utility/dbus_utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
 #include <systemd/sd-bus.h>
 
 namespace vpd
 {
+/**
+ * @brief PEL waiting to be created.
+ */
+struct EventLogger::PelRequest
+{
+    std::string m_message;
+    std::string m_severity;
+    std::map<std::string, std::string> m_additionalData;
+
+    // PELs with the same key are identical for merging.
+    std::string m_dedupKey;
+};
+
+/**
+ * @brief Queue of PELs waiting to be created.
+ *
+ * PELs are pushed by any thread without blocking and created one after other
+ * by a single dispatcher thread over its own D-Bus connection. Identical PELs
+ * created within PEL_DEDUP_WINDOW_SEC of the first one are merged into it.
+ */
+class EventLogger::PelQueue
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    PelQueue(const PelQueue&) = delete;
+    PelQueue& operator=(const PelQueue&) = delete;
+    PelQueue(PelQueue&&) = delete;
+    PelQueue& operator=(PelQueue&&) = delete;
+
+    /**
+     * @brief Constructor, starts the dispatcher thread.
+     */
+    PelQueue() : m_dispatcher(&PelQueue::dispatch, this) {}
+
+    /**
+     * @brief Destructor, waits for queued PELs to be created.
+     */
+    ~PelQueue()
+    {
+        m_isStopRequested.store(true, std::memory_order_release);
+        wakeDispatcher();
+
+        if (m_dispatcher.joinable())
+        {
+            m_dispatcher.join();
+        }
+    }
+
+    /**
+     * @brief API to queue a PEL.
+     *
+     * @param[in] i_request - PEL to be created.
+     *
+     * @return true if queued, false if dropped as the queue is full.
+     */
+    bool push(PelRequest&& i_request) noexcept
+    {
+        if (!m_requests.tryPush(std::move(i_request)))
+        {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        wakeDispatcher();
+        return true;
+    }
+
+  private:
+    /**
+     * @brief API to wake up the dispatcher thread.
+     */
+    void wakeDispatcher() noexcept
+    {
+        m_wakeCount.fetch_add(1, std::memory_order_release);
+        m_wakeCount.notify_one();
+    }
+
+    /**
+     * @brief API to check if an identical PEL was created within the window.
+     *
+     * Called only from the dispatcher thread.
+     *
+     * @param[in] i_request - PEL to be created.
+     *
+     * @return true if the PEL is to be merged, false otherwise.
+     */
+    bool isDuplicate(const PelRequest& i_request)
+    {
+        const auto l_now = std::chrono::steady_clock::now();
+        const auto l_window =
+            std::chrono::seconds(constants::PEL_DEDUP_WINDOW_SEC);
+
+        // Forget PELs created before the window.
+        std::erase_if(m_lastCreated, [&l_now, &l_window](const auto& l_entry) {
+            return (l_now - l_entry.second) >= l_window;
+        });
+
+        return !m_lastCreated.try_emplace(i_request.m_dedupKey, l_now).second;
+    }
+
+    /**
+     * @brief API to log count of PELs merged and dropped, if changed since
+     * last logged.
+     *
+     * Called only from the dispatcher thread.
+     */
+    void logCounts()
+    {
+        const uint64_t l_droppedCount =
+            m_droppedCount.load(std::memory_order_relaxed);
+
+        if (m_mergedCount == m_loggedMergedCount &&
+            l_droppedCount == m_loggedDroppedCount)
+        {
+            return;
+        }
+
+        logging::logMessage("PELs merged: " + std::to_string(m_mergedCount) +
+                            ", dropped as PEL queue was full: " +
+                            std::to_string(l_droppedCount));
+
+        m_loggedMergedCount = m_mergedCount;
+        m_loggedDroppedCount = l_droppedCount;
+    }
+
+    /**
+     * @brief Dispatcher thread, creates queued PELs till asked to stop.
+     *
+     * Count of PELs merged and dropped is logged every time the queue is
+     * drained, if it changed.
+     */
+    void dispatch()
+    {
+        while (true)
+        {
+            // Read before draining so that a push after draining is not
+            // missed.
+            const uint32_t l_wakeCount =
+                m_wakeCount.load(std::memory_order_acquire);
+
+            PelRequest l_request;
+            while (m_requests.tryPop(l_request))
+            {
+                if (isDuplicate(l_request))
+                {
+                    ++m_mergedCount;
+                    continue;
+                }
+
+                EventLogger::createPel(l_request);
+            }
+
+            logCounts();
+
+            if (m_isStopRequested.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            m_wakeCount.wait(l_wakeCount, std::memory_order_acquire);
+        }
+    }
+
+    // PELs waiting to be created.
+    BoundedQueue<PelRequest, constants::PEL_QUEUE_SIZE> m_requests;
+
+    // Dedup key of PELs created within the window, with time of creation.
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point>
+        m_lastCreated;
+
+    // Updated by any thread pushing a PEL.
+    std::atomic<uint64_t> m_droppedCount{0};
+
+    // Updated and read only by the dispatcher thread.
+    uint64_t m_mergedCount = 0;
+    uint64_t m_loggedMergedCount = 0;
+    uint64_t m_loggedDroppedCount = 0;
+
+    std::atomic<uint32_t> m_wakeCount{0};
+    std::atomic<bool> m_isStopRequested{false};
+
+    // Declared last so that it starts after rest of the members.
+    std::thread m_dispatcher;
+};
+
 const std::unordered_map<types::SeverityType, std::string>
     EventLogger::m_severityMap = {
         {types::SeverityType::Notice,
@@ -259,45 +454,117 @@ void EventLogger::createSyncPel(
     (void)i_procedure;
     try
     {
-        if (m_errorMsgMap.find(i_errorType) == m_errorMsgMap.end())
+        createPel(makePelRequest(i_errorType, i_severity, i_fileName,
+                                 i_funcName, i_internalRc, i_description,
+                                 i_userData1, i_userData2));
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Sync PEL creation failed with an error: " +
+                            std::string(l_ex.what()));
+    }
+}
+
+void EventLogger::createQueuedPel(
+    const types::ErrorType& i_errorType, const types::SeverityType& i_severity,
+    const std::string& i_fileName, const std::string& i_funcName,
+    const uint8_t i_internalRc, const std::string& i_description,
+    const std::optional<std::string> i_userData1,
+    const std::optional<std::string> i_userData2,
+    const std::optional<std::string> i_symFru,
+    const std::optional<std::string> i_procedure)
+{
+    (void)i_symFru;
+    (void)i_procedure;
+    try
+    {
+        PelRequest l_request = makePelRequest(
+            i_errorType, i_severity, i_fileName, i_funcName, i_internalRc,
+            i_description, i_userData1, i_userData2);
+
+        const std::string l_message = l_request.m_message;
+        const std::string l_description =
+            l_request.m_additionalData.at("DESCRIPTION");
+
+        if (!getPelQueue().push(std::move(l_request)))
         {
-            throw std::runtime_error("Unsupported error type received");
-            // TODO: Need to handle, instead of throwing an exception.
+            logging::logMessage("PEL queue full, dropped PEL: " + l_message +
+                                ", description: " + l_description);
         }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Queued PEL creation failed with an error: " +
+                            std::string(l_ex.what()));
+    }
+}
 
-        const std::string& l_message = m_errorMsgMap.at(i_errorType);
+EventLogger::PelRequest EventLogger::makePelRequest(
+    const types::ErrorType& i_errorType, const types::SeverityType& i_severity,
+    const std::string& i_fileName, const std::string& i_funcName,
+    const uint8_t i_internalRc, const std::string& i_description,
+    const std::optional<std::string>& i_userData1,
+    const std::optional<std::string>& i_userData2)
+{
+    if (m_errorMsgMap.find(i_errorType) == m_errorMsgMap.end())
+    {
+        throw std::runtime_error("Unsupported error type received");
+        // TODO: Need to handle, instead of throwing an exception.
+    }
 
-        const std::string& l_severity =
-            (m_severityMap.find(i_severity) != m_severityMap.end()
-                 ? m_severityMap.at(i_severity)
-                 : m_severityMap.at(types::SeverityType::Informational));
+    const std::string& l_message = m_errorMsgMap.at(i_errorType);
 
-        const std::string l_description =
-            ((!i_description.empty() ? i_description : "VPD generic error"));
+    const std::string& l_severity =
+        (m_severityMap.find(i_severity) != m_severityMap.end()
+             ? m_severityMap.at(i_severity)
+             : m_severityMap.at(types::SeverityType::Informational));
 
-        const std::string l_userData1 = ((i_userData1) ? (*i_userData1) : "");
+    const std::string l_description =
+        ((!i_description.empty() ? i_description : "VPD generic error"));
 
-        const std::string l_userData2 = ((i_userData2) ? (*i_userData2) : "");
+    const std::string l_userData1 = ((i_userData1) ? (*i_userData1) : "");
+
+    const std::string l_userData2 = ((i_userData2) ? (*i_userData2) : "");
+
+    PelRequest l_request;
+    l_request.m_message = l_message;
+    l_request.m_severity = l_severity;
+    l_request.m_additionalData = {
+        {"FileName", i_fileName},
+        {"FunctionName", i_funcName},
+        {"DESCRIPTION", l_description},
+        {"InteranlRc", std::to_string(i_internalRc)},
+        {"UserData1", l_userData1},
+        {"UserData2", l_userData2}};
+    l_request.m_dedupKey = l_message + "|" + l_severity + "|" + l_userData1 +
+                           "|" + l_userData2 + "|" + l_description;
+
+    return l_request;
+}
 
-        std::map<std::string, std::string> l_additionalData{
-            {"FileName", i_fileName},
-            {"FunctionName", i_funcName},
-            {"DESCRIPTION", l_description},
-            {"InteranlRc", std::to_string(i_internalRc)},
-            {"UserData1", l_userData1.c_str()},
-            {"UserData2", l_userData2.c_str()}};
+EventLogger::PelQueue& EventLogger::getPelQueue()
+{
+    static PelQueue l_pelQueue;
+    return l_pelQueue;
+}
 
-        auto l_bus = sdbusplus::bus::new_default();
+void EventLogger::createPel(const PelRequest& i_request)
+{
+    try
+    {
+        // Bus is per thread, hence persistent for the dispatcher thread.
+        auto& l_bus = dbusUtility::getBus();
         auto l_method =
             l_bus.new_method_call(constants::eventLoggingServiceName,
                                   constants::eventLoggingObjectPath,
                                   constants::eventLoggingInterface, "Create");
-        l_method.append(l_message, l_severity, l_additionalData);
+        l_method.append(i_request.m_message, i_request.m_severity,
+                        i_request.m_additionalData);
         l_bus.call(l_method);
     }
     catch (const sdbusplus::exception::SdBusError& l_ex)
     {
-        logging::logMessage("Sync PEL creation failed with an error: " +
+        logging::logMessage("PEL creation failed with an error: " +
                             std::string(l_ex.what()));
     }
 }
@@ -10,6 +10,8 @@
 #include <boost/bind/bind.hpp>
 #include <gpiod.hpp>
 
+#include <unistd.h>
+
 namespace vpd
 {
 void GpioEventHandler::handleChangeInGpioPin(const bool& i_isFruPresent)
@@ -43,7 +45,7 @@ void GpioEventHandler::handleChangeInGpioPin(const bool& i_isFruPresent)
         else
         {
             m_worker->deleteFruVpd(jsonUtility::getInventoryObjPathFromJson(
-                m_worker->getSysCfgJsonObj(), m_fruPath));
+                *m_worker->getSysCfgJsonObj(), m_fruPath));
         }
     }
     catch (std::exception& l_ex)
@@ -70,8 +72,8 @@ void GpioEventHandler::handleTimerExpiry(
     }
 
     bool l_currentPresencePinValue = jsonUtility::processGpioPresenceTag(
-        m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
-        "hotPlugging");
+        *m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
+        "hotPlugging", m_worker->getGpioService());
 
     if (m_prevPresencePinValue != l_currentPresencePinValue)
     {
@@ -86,12 +88,127 @@ void GpioEventHandler::handleTimerExpiry(
                     boost::asio::placeholders::error, i_timerObj));
 }
 
+void GpioEventHandler::setEdgeEventHandlerForGpioPresence(
+    const std::shared_ptr<boost::asio::io_context>& i_ioContext)
+{
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        m_worker->getSysCfgJsonObj();
+
+    const nlohmann::json& l_gpioPresence = l_sysCfgJsonObj->at("frus")
+                                               .at(m_fruPath)
+                                               .at(0)
+                                               .at("pollingRequired")
+                                               .at("hotPlugging")
+                                               .at("gpioPresence");
+
+    m_presencePinName = l_gpioPresence.at("pin").get<std::string>();
+    m_presencePinValue = l_gpioPresence.at("value").get<int>();
+
+    m_presenceLine = m_worker->getGpioService().requestEdgeEvents(
+        m_presencePinName, "Monitor the presence line");
+
+    // Descriptor owns a duplicate so that the line keeps its own.
+    const int l_eventFd = ::dup(m_presenceLine.event_get_fd());
+    if (l_eventFd < 0)
+    {
+        throw GpioException("Failed to duplicate event fd of GPIO line [" +
+                            m_presencePinName + "]");
+    }
+
+    m_eventDescriptor = std::make_unique<boost::asio::posix::stream_descriptor>(
+        *i_ioContext, l_eventFd);
+
+    m_prevPresencePinValue =
+        (m_presencePinValue ==
+         m_worker->getGpioService().getValue(m_presencePinName,
+                                             "Read the presence line"));
+
+    waitForEdgeEvent();
+}
+
+void GpioEventHandler::waitForEdgeEvent()
+{
+    m_eventDescriptor->async_wait(
+        boost::asio::posix::stream_descriptor::wait_read,
+        [this](const boost::system::error_code& l_errorCode) {
+            handleEdgeEvent(l_errorCode);
+        });
+}
+
+void GpioEventHandler::handleEdgeEvent(
+    const boost::system::error_code& i_errorCode)
+{
+    if (i_errorCode == boost::asio::error::operation_aborted)
+    {
+        logging::logMessage("Edge event wait aborted for GPIO pin");
+        return;
+    }
+
+    if (i_errorCode)
+    {
+        logging::logMessage("Edge event wait failed for gpio pin" +
+                            std::string(i_errorCode.message()));
+        return;
+    }
+
+    try
+    {
+        // Consume pending events, presence is read once the line settles.
+        m_presenceLine.event_read_multiple();
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to read edge event for GPIO pin [" +
+                            m_presencePinName +
+                            "], error: " + std::string(l_ex.what()));
+    }
+
+    // (Re)start the quiet period, bounces restart it.
+    m_debouncer.trigger([this]() { handleSettledPresence(); });
+
+    waitForEdgeEvent();
+}
+
+void GpioEventHandler::handleSettledPresence()
+{
+    try
+    {
+        const bool l_currentPresencePinValue =
+            (m_presencePinValue == m_worker->getGpioService().getValue(
+                                       m_presencePinName,
+                                       "Read the presence line"));
+
+        if (m_prevPresencePinValue != l_currentPresencePinValue)
+        {
+            m_prevPresencePinValue = l_currentPresencePinValue;
+            handleChangeInGpioPin(l_currentPresencePinValue);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to read GPIO pin [" + m_presencePinName +
+                            "], error: " + std::string(l_ex.what()));
+    }
+}
+
 void GpioEventHandler::setEventHandlerForGpioPresence(
     const std::shared_ptr<boost::asio::io_context>& i_ioContext)
 {
+    try
+    {
+        setEdgeEventHandlerForGpioPresence(i_ioContext);
+        return;
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage(
+            "Edge events not available for presence of [" + m_fruPath +
+            "], falling back to polling. Error: " + std::string(l_ex.what()));
+    }
+
     m_prevPresencePinValue = jsonUtility::processGpioPresenceTag(
-        m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
-        "hotPlugging");
+        *m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
+        "hotPlugging", m_worker->getGpioService());
 
     static std::vector<std::shared_ptr<boost::asio::steady_timer>> l_timers;
 
@@ -110,7 +227,7 @@ void GpioMonitor::initHandlerForGpio(
     const std::shared_ptr<Worker>& i_worker)
 {
     std::vector<std::string> l_gpioPollingRequiredFrusList =
-        jsonUtility::getListOfGpioPollingFrus(m_sysCfgJsonObj);
+        jsonUtility::getListOfGpioPollingFrus(*m_sysCfgJsonObj);
 
     for (const auto& l_fruPath : l_gpioPollingRequiredFrusList)
     {
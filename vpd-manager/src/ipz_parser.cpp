@@ -11,6 +11,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <map>
 #include <typeindex>
 
 namespace vpd
@@ -73,11 +74,12 @@ bool IpzVpdParser::vhdrEccCheck()
         Length::VHDR_ECC_LENGTH);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
-            "One bit correction for VHDR performed", std::nullopt, std::nullopt,
-            std::nullopt, std::nullopt);
+            "One bit correction for VHDR performed for [" + m_vpdFilePath +
+                "]",
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
     }
     else if (l_status != VPD_ECC_OK)
     {
@@ -119,11 +121,12 @@ bool IpzVpdParser::vtocEccCheck()
         const_cast<uint8_t*>(&vpdPtr[vtocECCOffset]), vtocECCLength);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
-            "One bit correction for VTOC performed", std::nullopt, std::nullopt,
-            std::nullopt, std::nullopt);
+            "One bit correction for VTOC performed for [" + m_vpdFilePath +
+                "]",
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
     }
     else if (l_status != VPD_ECC_OK)
     {
@@ -166,11 +169,12 @@ bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
 
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
-            "One bit correction for record performed", std::nullopt,
-            std::nullopt, std::nullopt, std::nullopt);
+            "One bit correction for record performed for [" + m_vpdFilePath +
+                "]",
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
     }
     else if (l_status != VPD_ECC_OK)
     {
@@ -725,91 +729,138 @@ int IpzVpdParser::setKeywordValueInRecord(
 int IpzVpdParser::writeKeywordOnHardware(
     const types::WriteVpdParams i_paramsToWriteData)
 {
-    int l_sizeWritten = -1;
+    const types::WriteResult l_result =
+        writeKeywordsOnHardware({i_paramsToWriteData}).front();
 
-    try
+    if (!l_result.has_value())
     {
-        types::Record l_recordName;
-        types::Keyword l_keywordName;
-        types::BinaryVector l_keywordData;
+        std::rethrow_exception(l_result.error());
+    }
 
-        // Extract record, keyword and value from i_paramsToWriteData
-        if (const types::IpzData* l_ipzData =
-                std::get_if<types::IpzData>(&i_paramsToWriteData))
-        {
-            l_recordName = std::get<0>(*l_ipzData);
-            l_keywordName = std::get<1>(*l_ipzData);
-            l_keywordData = std::get<2>(*l_ipzData);
-        }
-        else
-        {
-            logging::logMessage(
-                "Input parameter type provided isn't compatible with the given FRU's VPD type.");
-            throw types::DbusInvalidArgument();
-        }
+    return l_result.value();
+}
 
-        if (l_recordName == "VHDR" || l_recordName == "VTOC")
-        {
-            logging::logMessage(
-                "Write operation not allowed on the given record : " +
-                l_recordName);
-            throw types::DbusNotAllowed();
-        }
+std::vector<types::WriteResult> IpzVpdParser::writeKeywordsOnHardware(
+    const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+{
+    std::vector<types::WriteResult> l_results;
+    l_results.reserve(i_paramsToWriteData.size());
+
+    // Details of the records updated, against their offset, along with index
+    // of the writes done on them.
+    std::map<types::RecordOffset,
+             std::pair<types::RecordData, std::vector<size_t>>>
+        l_updatedRecords;
 
-        if (l_keywordData.size() == 0)
+    auto l_vpdBegin = m_vpdVector.begin();
+
+    // Get VTOC offset
+    std::ranges::advance(l_vpdBegin, Offset::VTOC_PTR, m_vpdVector.end());
+    auto l_vtocOffset = readUInt16LE(l_vpdBegin);
+
+    // Create a local copy of m_vpdVector to perform keyword update and ecc
+    // update on filestream.
+    types::BinaryVector l_vpdVector = m_vpdVector;
+
+    for (const auto& l_paramsToWriteData : i_paramsToWriteData)
+    {
+        try
         {
-            logging::logMessage(
-                "Write operation not allowed as the given keyword's data length is 0.");
-            throw types::DbusInvalidArgument();
-        }
+            types::Record l_recordName;
+            types::Keyword l_keywordName;
+            types::BinaryVector l_keywordData;
+
+            // Extract record, keyword and value from l_paramsToWriteData
+            if (const types::IpzData* l_ipzData =
+                    std::get_if<types::IpzData>(&l_paramsToWriteData))
+            {
+                l_recordName = std::get<0>(*l_ipzData);
+                l_keywordName = std::get<1>(*l_ipzData);
+                l_keywordData = std::get<2>(*l_ipzData);
+            }
+            else
+            {
+                logging::logMessage(
+                    "Input parameter type provided isn't compatible with the given FRU's VPD type.");
+                throw types::DbusInvalidArgument();
+            }
 
-        auto l_vpdBegin = m_vpdVector.begin();
+            if (l_recordName == "VHDR" || l_recordName == "VTOC")
+            {
+                logging::logMessage(
+                    "Write operation not allowed on the given record : " +
+                    l_recordName);
+                throw types::DbusNotAllowed();
+            }
 
-        // Get VTOC offset
-        std::ranges::advance(l_vpdBegin, Offset::VTOC_PTR, m_vpdVector.end());
-        auto l_vtocOffset = readUInt16LE(l_vpdBegin);
+            if (l_keywordData.size() == 0)
+            {
+                logging::logMessage(
+                    "Write operation not allowed as the given keyword's data length is 0.");
+                throw types::DbusInvalidArgument();
+            }
 
-        // Get the details of user given record from VTOC
-        const types::RecordData& l_inputRecordDetails =
-            getRecordDetailsFromVTOC(l_recordName, l_vtocOffset);
+            // Get the details of user given record from VTOC
+            const types::RecordData& l_inputRecordDetails =
+                getRecordDetailsFromVTOC(l_recordName, l_vtocOffset);
 
-        const auto& l_inputRecordOffset = std::get<0>(l_inputRecordDetails);
+            const auto& l_inputRecordOffset = std::get<0>(l_inputRecordDetails);
 
-        if (l_inputRecordOffset == 0)
-        {
-            throw(DataException("Record not found in VTOC PT keyword."));
-        }
+            if (l_inputRecordOffset == 0)
+            {
+                throw(DataException("Record not found in VTOC PT keyword."));
+            }
 
-        // Create a local copy of m_vpdVector to perform keyword update and ecc
-        // update on filestream.
-        types::BinaryVector l_vpdVector = m_vpdVector;
+            // write keyword's value on hardware
+            const int l_sizeWritten = setKeywordValueInRecord(
+                l_recordName, l_keywordName, l_keywordData,
+                l_inputRecordOffset, l_vpdVector);
 
-        // write keyword's value on hardware
-        l_sizeWritten =
-            setKeywordValueInRecord(l_recordName, l_keywordName, l_keywordData,
-                                    l_inputRecordOffset, l_vpdVector);
+            if (l_sizeWritten <= 0)
+            {
+                throw(DataException("Unable to set value on " + l_recordName +
+                                    ":" + l_keywordName));
+            }
 
-        if (l_sizeWritten <= 0)
-        {
-            throw(DataException("Unable to set value on " + l_recordName + ":" +
-                                l_keywordName));
-        }
+            l_updatedRecords
+                .try_emplace(l_inputRecordOffset, l_inputRecordDetails,
+                             std::vector<size_t>{})
+                .first->second.second.push_back(l_results.size());
 
-        // Update the record's ECC
-        updateRecordECC(l_inputRecordOffset, std::get<1>(l_inputRecordDetails),
-                        std::get<2>(l_inputRecordDetails),
-                        std::get<3>(l_inputRecordDetails), l_vpdVector);
+            l_results.emplace_back(l_sizeWritten);
 
-        logging::logMessage(std::to_string(l_sizeWritten) +
-                            " bytes updated successfully on hardware for " +
-                            l_recordName + ":" + l_keywordName);
+            logging::logMessage(std::to_string(l_sizeWritten) +
+                                " bytes updated successfully on hardware for " +
+                                l_recordName + ":" + l_keywordName);
+        }
+        catch (const std::exception&)
+        {
+            l_results.emplace_back(std::unexpected(std::current_exception()));
+        }
     }
-    catch (const std::exception& l_exception)
+
+    // Update ECC of each updated record once.
+    for (const auto& [l_recordOffset, l_record] : l_updatedRecords)
     {
-        throw;
+        const auto& [l_recordDetails, l_writeIndexes] = l_record;
+
+        try
+        {
+            updateRecordECC(l_recordOffset, std::get<1>(l_recordDetails),
+                            std::get<2>(l_recordDetails),
+                            std::get<3>(l_recordDetails), l_vpdVector);
+        }
+        catch (const std::exception&)
+        {
+            // Keyword writes on the record are incomplete without its ECC.
+            for (const auto l_index : l_writeIndexes)
+            {
+                l_results[l_index] = std::unexpected(std::current_exception());
+            }
+        }
     }
 
-    return l_sizeWritten;
+    return l_results;
 }
 
 bool IpzVpdParser::processInvalidRecords(
@@ -842,7 +893,7 @@ bool IpzVpdParser::processInvalidRecords(
 
         // Log a Predictive PEL, including names and respective error messages
         // of all invalid records
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             types::ErrorType::InvalidVpdMessage, types::SeverityType::Warning,
             __FILE__, __FUNCTION__, constants::VALUE_0,
             std::string("Invalid records found while parsing VPD for [" +
@@ -1,23 +1,408 @@
 #include "logger.hpp"
 
-#include <sstream>
+#include "bounded_queue.hpp"
+#include "constants.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <systemd/sd-journal.h>
 
 namespace vpd
 {
 namespace logging
 {
-void logMessage(std::string_view message, const std::source_location& location)
+/**
+ * @brief A message waiting to be written to journal.
+ */
+struct LogRecord
+{
+    LogLevel m_level = LogLevel::Info;
+
+    // Strings of source_location have static storage duration.
+    const char* m_fileName = "";
+    const char* m_functionName = "";
+    uint32_t m_line = 0;
+
+    size_t m_length = 0;
+    std::array<char, constants::LOG_MESSAGE_MAX_SIZE> m_message;
+};
+
+/**
+ * @brief Log buffer of a thread.
+ */
+struct LogBuffer
+{
+    BoundedQueue<LogRecord, constants::LOG_BUFFER_SIZE> m_records;
+
+    // Messages dropped as the buffer was full.
+    std::atomic<uint64_t> m_droppedCount{0};
+
+    // Set once the owner thread exits.
+    std::atomic<bool> m_isOrphan{false};
+};
+
+// Sink messages are written to in place of journal, if set.
+static std::atomic<LogSink> s_logSink{nullptr};
+
+/**
+ * @brief API to write a message to journal.
+ *
+ * @param[in] i_level - Level of the message.
+ * @param[in] i_message - Message.
+ * @param[in] i_fileName - Source file name.
+ * @param[in] i_line - Source line.
+ * @param[in] i_functionName - Source function name.
+ */
+static void writeToJournal(LogLevel i_level, std::string_view i_message,
+                           const char* i_fileName, uint32_t i_line,
+                           const char* i_functionName) noexcept
 {
-    std::ostringstream log;
-    log << "FileName: " << location.file_name() << ","
-        << " Line: " << location.line() << " " << message;
+    if (const LogSink l_sink = s_logSink.load(std::memory_order_acquire))
+    {
+        l_sink(i_level, i_message, i_fileName, i_line, i_functionName);
+        return;
+    }
+
+    sd_journal_send("MESSAGE=FileName: %s, Line: %u %.*s", i_fileName, i_line,
+                    static_cast<int>(i_message.size()), i_message.data(),
+                    "PRIORITY=%d", static_cast<int>(i_level), "CODE_FILE=%s",
+                    i_fileName, "CODE_LINE=%u", i_line, "CODE_FUNC=%s",
+                    i_functionName, nullptr);
+}
+
+/**
+ * @brief Class to drain log buffers of all threads to journal.
+ *
+ * Each thread logs to its own buffer without taking a lock. A background
+ * thread writes the buffered messages to journal every LOG_DRAIN_INTERVAL_MS,
+ * or right away for warnings and errors. Buffers are drained one last time
+ * when the process exits or terminates on an unhandled exception, messages
+ * logged after that are written to journal directly.
+ */
+class LogDrain
+{
+  public:
+    /**
+     * List of deleted functions.
+     */
+    LogDrain(const LogDrain&) = delete;
+    LogDrain& operator=(const LogDrain&) = delete;
+    LogDrain(LogDrain&&) = delete;
+    LogDrain& operator=(LogDrain&&) = delete;
+
+    /**
+     * @brief API to get the instance, created on first use.
+     *
+     * The instance is never destroyed so that threads logging while the
+     * process exits are safe.
+     *
+     * @return Log drain instance.
+     */
+    static LogDrain& getInstance()
+    {
+        static LogDrain* l_logDrain = new LogDrain();
+        return *l_logDrain;
+    }
+
+    /**
+     * @brief API to get log buffer of the calling thread.
+     *
+     * @return Log buffer of the calling thread.
+     */
+    LogBuffer& getThreadBuffer()
+    {
+        thread_local ThreadBuffer l_threadBuffer(*this);
+        return *l_threadBuffer.m_buffer;
+    }
+
+    /**
+     * @brief API to wake up the drain thread.
+     */
+    void wake() noexcept
+    {
+        m_wakeCondition.notify_one();
+    }
+
+    /**
+     * @brief API to check if draining has stopped.
+     *
+     * @return true if stopped, false otherwise.
+     */
+    bool isStopped() const noexcept
+    {
+        return m_isStopped.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief API to write messages from all the buffers to journal.
+     *
+     * Used by a thread which queued a message but found draining stopped, as
+     * the last drain may have missed it.
+     */
+    void flush()
+    {
+        std::lock_guard<std::mutex> l_lock(m_flushMutex);
+        flushBuffers();
+    }
+
+  private:
+    /**
+     * @brief Holds the log buffer for lifetime of a thread.
+     */
+    struct ThreadBuffer
+    {
+        explicit ThreadBuffer(LogDrain& i_logDrain) :
+            m_buffer(std::make_shared<LogBuffer>())
+        {
+            std::lock_guard<std::mutex> l_lock(i_logDrain.m_buffersMutex);
+            i_logDrain.m_buffers.push_back(m_buffer);
+        }
+
+        ~ThreadBuffer()
+        {
+            // Drain thread forgets the buffer once drained.
+            m_buffer->m_isOrphan.store(true, std::memory_order_release);
+        }
+
+        std::shared_ptr<LogBuffer> m_buffer;
+    };
+
+    /**
+     * @brief Constructor, starts the drain thread.
+     */
+    LogDrain() : m_drainThread(&LogDrain::drain, this)
+    {
+        std::atexit([]() { getInstance().stop(); });
+
+        s_previousTerminateHandler = std::set_terminate([]() {
+            getInstance().stopOnTerminate();
+
+            if (s_previousTerminateHandler)
+            {
+                s_previousTerminateHandler();
+            }
+            std::abort();
+        });
+    }
+
+    /**
+     * @brief Drain thread, drains buffers till asked to stop.
+     */
+    void drain()
+    {
+        std::unique_lock<std::mutex> l_lock(m_wakeMutex);
+        while (!m_isStopRequested)
+        {
+            m_wakeCondition.wait_for(
+                l_lock,
+                std::chrono::milliseconds(constants::LOG_DRAIN_INTERVAL_MS));
+
+            l_lock.unlock();
+            flush();
+            l_lock.lock();
+        }
+    }
+
+    /**
+     * @brief API to write messages from all the buffers to journal.
+     *
+     * Caller should hold the flush mutex.
+     */
+    void flushBuffers()
+    {
+        std::vector<std::shared_ptr<LogBuffer>> l_buffers;
+        {
+            std::lock_guard<std::mutex> l_lock(m_buffersMutex);
+            l_buffers = m_buffers;
+        }
+
+        LogRecord l_record;
+        bool l_hasOrphan = false;
+        for (const auto& l_buffer : l_buffers)
+        {
+            // Read before draining, an orphan can't log after it is drained.
+            const bool l_isOrphan =
+                l_buffer->m_isOrphan.load(std::memory_order_acquire);
+            l_hasOrphan = l_hasOrphan || l_isOrphan;
+
+            while (l_buffer->m_records.tryPop(l_record))
+            {
+                writeToJournal(
+                    l_record.m_level,
+                    std::string_view(l_record.m_message.data(),
+                                     l_record.m_length),
+                    l_record.m_fileName, l_record.m_line,
+                    l_record.m_functionName);
+            }
+
+            const uint64_t l_droppedCount =
+                l_buffer->m_droppedCount.exchange(0, std::memory_order_relaxed);
+            if (l_droppedCount != 0)
+            {
+                const auto l_location = std::source_location::current();
+                writeToJournal(LogLevel::Warning,
+                               std::to_string(l_droppedCount) +
+                                   " log messages dropped as buffer was full",
+                               l_location.file_name(), l_location.line(),
+                               l_location.function_name());
+            }
+        }
+
+        if (l_hasOrphan)
+        {
+            std::lock_guard<std::mutex> l_lock(m_buffersMutex);
+            std::erase_if(m_buffers, [&l_buffers](const auto& l_buffer) {
+                return l_buffer->m_isOrphan.load(std::memory_order_acquire) &&
+                       std::find(l_buffers.cbegin(), l_buffers.cend(),
+                                 l_buffer) != l_buffers.cend();
+            });
+        }
+    }
+
+    /**
+     * @brief API to stop the drain thread and drain the buffers.
+     */
+    void stop()
+    {
+        // Stopped first, so that messages queued from here on are either
+        // drained below or flushed by the thread queuing them. Pairs with the
+        // fence in queueMessage.
+        m_isStopped.store(true, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        {
+            std::lock_guard<std::mutex> l_lock(m_wakeMutex);
+            m_isStopRequested = true;
+        }
+        m_wakeCondition.notify_one();
+
+        if (m_drainThread.joinable())
+        {
+            m_drainThread.join();
+        }
+
+        flush();
+    }
+
+    /**
+     * @brief API to drain the buffers when the process terminates.
+     *
+     * Drain thread is left running as the process is about to abort, and may
+     * be the one terminating. Buffers are not drained if the flush mutex is
+     * held, as the terminating thread may be the one holding it.
+     */
+    void stopOnTerminate() noexcept
+    {
+        m_isStopped.store(true, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::unique_lock<std::mutex> l_lock(m_flushMutex, std::try_to_lock);
+        if (l_lock.owns_lock())
+        {
+            flushBuffers();
+        }
+    }
+
+    // Handler to chain to on termination.
+    static inline std::terminate_handler s_previousTerminateHandler = nullptr;
+
+    // Buffers of all the threads which logged.
+    std::mutex m_buffersMutex;
+    std::vector<std::shared_ptr<LogBuffer>> m_buffers;
+
+    // Serialises draining, so messages of a buffer are written in order.
+    std::mutex m_flushMutex;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    bool m_isStopRequested = false;
+    std::atomic<bool> m_isStopped{false};
+
+    // Declared last so that it starts after rest of the members.
+    std::thread m_drainThread;
+};
+
+void setLogSink(LogSink i_sink) noexcept
+{
+    s_logSink.store(i_sink, std::memory_order_release);
+}
+
+void queueMessage(LogLevel i_level, std::string_view i_message,
+                  const std::source_location& i_location) noexcept
+{
+    try
+    {
+        LogDrain& l_logDrain = LogDrain::getInstance();
+        if (l_logDrain.isStopped())
+        {
+            // Process is exiting, nothing left to drain.
+            writeToJournal(i_level, i_message, i_location.file_name(),
+                           i_location.line(), i_location.function_name());
+            return;
+        }
+
+        LogRecord l_record;
+        if (i_message.size() > l_record.m_message.size())
+        {
+            // Doesn't fit in a record, written as is rather than truncated.
+            writeToJournal(i_level, i_message, i_location.file_name(),
+                           i_location.line(), i_location.function_name());
+            return;
+        }
+
+        l_record.m_level = i_level;
+        l_record.m_fileName = i_location.file_name();
+        l_record.m_functionName = i_location.function_name();
+        l_record.m_line = i_location.line();
+        l_record.m_length = i_message.size();
+        std::copy_n(i_message.data(), l_record.m_length,
+                    l_record.m_message.data());
+
+        LogBuffer& l_buffer = l_logDrain.getThreadBuffer();
+        if (!l_buffer.m_records.tryPush(std::move(l_record)))
+        {
+            if (i_level <= LogLevel::Warning)
+            {
+                // Warnings and errors are never dropped, written out of order
+                // instead.
+                writeToJournal(i_level, i_message, i_location.file_name(),
+                               i_location.line(), i_location.function_name());
+                return;
+            }
+
+            l_buffer.m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        }
 
-    /* TODO: Check on this later.
-    log << "FileName: " << location.file_name() << ","
-        << " Line: " << location.line() << ","
-        << " Func: " << location.function_name() << ", " << message;*/
+        // Draining may have stopped after the check above, in which case the
+        // last drain may have missed the message. Pairs with the fence in
+        // stop.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (l_logDrain.isStopped())
+        {
+            l_logDrain.flush();
+            return;
+        }
 
-    std::cout << log.str() << std::endl;
+        if (i_level <= LogLevel::Warning)
+        {
+            l_logDrain.wake();
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Nothing can be done if logging fails.
+    }
 }
 } // namespace logging
 } // namespace vpd
@@ -9,6 +9,7 @@
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
 #include "single_fab.hpp"
+#include "system_state_cache.hpp"
 #include "types.hpp"
 #include "utility/dbus_utility.hpp"
 #include "utility/json_utility.hpp"
@@ -18,6 +19,8 @@
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
+#include <cerrno>
+
 namespace vpd
 {
 Manager::Manager(
@@ -26,10 +29,13 @@ Manager::Manager(
     const std::shared_ptr<sdbusplus::asio::connection>& asioConnection) :
     m_ioContext(ioCon), m_interface(iFace), m_asioConnection(asioConnection)
 {
+    // Keep chassis, host and BMC state cached for the life of the service.
+    m_systemStateCache->subscribe(m_asioConnection);
+
 #ifdef IBM_SYSTEM
-    if (!dbusUtility::isChassisPowerOn())
+    if (!m_systemStateCache->isChassisPowerOn())
     {
-        SingleFab l_singleFab;
+        SingleFab l_singleFab(m_pinnedKeyword, *m_uBootEnv);
         const int& l_rc = l_singleFab.singleFabImOverride();
 
         if (l_rc == constants::FAILURE)
@@ -43,73 +49,158 @@ Manager::Manager(
 
     try
     {
+        // Methods accessing hardware are run on the I/O worker pool, so a slow
+        // EEPROM doesn't block the event loop. Tasks are ordered on the EEPROM
+        // the given path resolves to.
         // For backward compatibility. Should be depricated.
         iFace->register_method(
             "WriteKeyword",
-            [this](const sdbusplus::message::object_path i_path,
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path i_path,
                    const std::string i_recordName, const std::string i_keyword,
                    const types::BinaryVector i_value) -> int {
-                return this->updateKeyword(
-                    i_path, std::make_tuple(i_recordName, i_keyword, i_value));
+                return this->runOnIoPool(
+                    i_yield, i_path,
+                    [this, i_path, i_recordName, i_keyword, i_value]() {
+                        return this->updateKeyword(
+                            i_path, std::make_tuple(i_recordName, i_keyword,
+                                                    i_value));
+                    });
             });
 
         // Register methods under com.ibm.VPD.Manager interface
         iFace->register_method(
             "UpdateKeyword",
-            [this](const types::Path i_vpdPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_vpdPath,
                    const types::WriteVpdParams i_paramsToWriteData) -> int {
-                return this->updateKeyword(i_vpdPath, i_paramsToWriteData);
+                return this->runOnIoPool(
+                    i_yield, i_vpdPath,
+                    [this, i_vpdPath, i_paramsToWriteData]() {
+                        return this->updateKeyword(i_vpdPath,
+                                                   i_paramsToWriteData);
+                    });
             });
 
         iFace->register_method(
             "WriteKeywordOnHardware",
-            [this](const types::Path i_fruPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_fruPath,
                    const types::WriteVpdParams i_paramsToWriteData) -> int {
-                return this->updateKeywordOnHardware(i_fruPath,
-                                                     i_paramsToWriteData);
+                return this->runOnIoPool(
+                    i_yield, i_fruPath,
+                    [this, i_fruPath, i_paramsToWriteData]() {
+                        return this->updateKeywordOnHardware(
+                            i_fruPath, i_paramsToWriteData);
+                    });
             });
 
         iFace->register_method(
             "ReadKeyword",
-            [this](const types::Path i_fruPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_fruPath,
                    const types::ReadVpdParams i_paramsToReadData)
                 -> types::DbusVariantType {
-                return this->readKeyword(i_fruPath, i_paramsToReadData);
+                return this->runOnIoPool(
+                    i_yield, i_fruPath,
+                    [this, i_fruPath, i_paramsToReadData]() {
+                        return this->readKeyword(i_fruPath, i_paramsToReadData);
+                    });
+            });
+
+        iFace->register_method(
+            "ReadKeywords",
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_fruPath,
+                   const std::vector<types::IpzType> i_keywordsToRead)
+                -> types::ReadKeywordsResult {
+                return this->runOnIoPool(
+                    i_yield, i_fruPath, [this, i_fruPath, i_keywordsToRead]() {
+                        return this->readKeywords(i_fruPath, i_keywordsToRead);
+                    });
+            });
+
+        iFace->register_method(
+            "GetFRUVPD",
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_vpdPath,
+                   const bool i_readFromHardware) -> types::FruVpdMap {
+                return this->runOnIoPool(
+                    i_yield, i_vpdPath,
+                    [this, i_vpdPath, i_readFromHardware]() {
+                        return this->getFruVpd(i_vpdPath, i_readFromHardware);
+                    });
             });
 
         iFace->register_method(
             "CollectFRUVPD",
-            [this](const sdbusplus::message::object_path& i_dbusObjPath) {
-                this->collectSingleFruVpd(i_dbusObjPath);
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path& i_dbusObjPath) {
+                // Status is set on the event loop, hence checked here before
+                // handing the collection over to the I/O worker pool.
+                if (m_vpdCollectionStatus != "Completed")
+                {
+                    logging::logMessage(
+                        "Currently VPD CollectionStatus is not completed. Cannot perform single FRU VPD collection for " +
+                        std::string(i_dbusObjPath));
+                    return;
+                }
+
+                this->runOnIoPool(i_yield, i_dbusObjPath,
+                                  [this, i_dbusObjPath]() {
+                                      this->collectSingleFruVpd(i_dbusObjPath);
+                                      return true;
+                                  });
             });
 
         iFace->register_method(
             "deleteFRUVPD",
-            [this](const sdbusplus::message::object_path& i_dbusObjPath) {
-                this->deleteSingleFruVpd(i_dbusObjPath);
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path& i_dbusObjPath) {
+                this->runOnIoPool(i_yield, i_dbusObjPath,
+                                  [this, i_dbusObjPath]() {
+                                      this->deleteSingleFruVpd(i_dbusObjPath);
+                                      return true;
+                                  });
             });
 
+        // Location code methods don't access an EEPROM, need no ordering.
         iFace->register_method(
             "GetExpandedLocationCode",
-            [this](const std::string& i_unexpandedLocationCode,
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_unexpandedLocationCode,
                    uint16_t& i_nodeNumber) -> std::string {
-                return this->getExpandedLocationCode(i_unexpandedLocationCode,
-                                                     i_nodeNumber);
+                return this->runOnIoPool(
+                    i_yield, types::Path{},
+                    [this, i_unexpandedLocationCode, i_nodeNumber]() {
+                        return this->getExpandedLocationCode(
+                            i_unexpandedLocationCode, i_nodeNumber);
+                    });
             });
 
-        iFace->register_method("GetFRUsByExpandedLocationCode",
-                               [this](const std::string& i_expandedLocationCode)
-                                   -> types::ListOfPaths {
-                                   return this->getFrusByExpandedLocationCode(
-                                       i_expandedLocationCode);
-                               });
+        iFace->register_method(
+            "GetFRUsByExpandedLocationCode",
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_expandedLocationCode)
+                -> types::ListOfPaths {
+                return this->runOnIoPool(
+                    i_yield, types::Path{}, [this, i_expandedLocationCode]() {
+                        return this->getFrusByExpandedLocationCode(
+                            i_expandedLocationCode);
+                    });
+            });
 
         iFace->register_method(
             "GetFRUsByUnexpandedLocationCode",
-            [this](const std::string& i_unexpandedLocationCode,
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_unexpandedLocationCode,
                    uint16_t& i_nodeNumber) -> types::ListOfPaths {
-                return this->getFrusByUnexpandedLocationCode(
-                    i_unexpandedLocationCode, i_nodeNumber);
+                return this->runOnIoPool(
+                    i_yield, types::Path{},
+                    [this, i_unexpandedLocationCode, i_nodeNumber]() {
+                        return this->getFrusByUnexpandedLocationCode(
+                            i_unexpandedLocationCode, i_nodeNumber);
+                    });
             });
 
         iFace->register_method(
@@ -138,9 +229,10 @@ Manager::Manager(
 #ifdef IBM_SYSTEM
         m_ibmHandler = std::make_shared<IbmHandler>(
             m_worker, m_backupAndRestoreObj, m_interface, m_ioContext,
-            m_asioConnection);
+            m_asioConnection, m_uBootEnv, m_systemStateCache);
 #else
-        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT);
+        m_worker = std::make_shared<Worker>(INVENTORY_JSON_DEFAULT, m_uBootEnv,
+                                            m_systemStateCache);
         m_interface->set_property("CollectionStatus", std::string("Completed"));
 #endif
     }
@@ -159,42 +251,53 @@ Manager::Manager(
 int Manager::updateKeyword(const types::Path i_vpdPath,
                            const types::WriteVpdParams i_paramsToWriteData)
 {
+    return updateKeywords(i_vpdPath, {i_paramsToWriteData}).front();
+}
+
+std::vector<int> Manager::updateKeywords(
+    const types::Path& i_vpdPath,
+    const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+{
+    std::vector<int> l_results(i_paramsToWriteData.size(), constants::FAILURE);
+
     if (i_vpdPath.empty())
     {
         logging::logMessage("Given VPD path is empty.");
-        return -1;
+        return l_results;
     }
 
-    types::Path l_fruPath;
-    nlohmann::json l_sysCfgJsonObj{};
+    std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        std::make_shared<const nlohmann::json>();
+    std::shared_ptr<EepromWriteQueue> l_eepromWriteQueue;
 
     if (m_worker.get() != nullptr)
     {
         l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-
-        // Get the EEPROM path
-        if (!l_sysCfgJsonObj.empty())
-        {
-            l_fruPath =
-                jsonUtility::getFruPathFromJson(l_sysCfgJsonObj, i_vpdPath);
-        }
+        l_eepromWriteQueue = m_worker->getEepromWriteQueue();
     }
 
-    if (l_fruPath.empty())
-    {
-        l_fruPath = i_vpdPath;
-    }
+    const types::Path l_fruPath = getEepromPath(i_vpdPath);
 
     try
     {
-        std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj);
-        auto l_rc = l_parserObj->updateVpdKeyword(i_paramsToWriteData);
+        std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
+            l_fruPath, l_sysCfgJsonObj, l_eepromWriteQueue);
+        l_results = l_parserObj->updateVpdKeywords(i_paramsToWriteData);
 
-        if (l_rc != constants::FAILURE && m_backupAndRestoreObj)
+        for (size_t l_index = 0; l_index < i_paramsToWriteData.size();
+             ++l_index)
         {
-            if (m_backupAndRestoreObj->updateKeywordOnPrimaryOrBackupPath(
-                    l_fruPath, i_paramsToWriteData) < constants::VALUE_0)
+            if (l_results[l_index] == constants::FAILURE)
+            {
+                continue;
+            }
+
+            const types::WriteVpdParams& l_paramsToWriteData =
+                i_paramsToWriteData[l_index];
+
+            if (m_backupAndRestoreObj &&
+                m_backupAndRestoreObj->updateKeywordOnPrimaryOrBackupPath(
+                    l_fruPath, l_paramsToWriteData) < constants::VALUE_0)
             {
                 logging::logMessage(
                     "Write success, but backup and restore failed for file[" +
@@ -202,28 +305,15 @@ int Manager::updateKeyword(const types::Path i_vpdPath,
             }
         }
 
-        // update keyword in inherited FRUs
-        if (l_rc != constants::FAILURE)
-        {
-            vpdSpecificUtility::updateKwdOnInheritedFrus(
-                l_fruPath, i_paramsToWriteData, l_sysCfgJsonObj);
-        }
-
-        // update common interface(s) properties
-        if (l_rc != constants::FAILURE)
-        {
-            vpdSpecificUtility::updateCiPropertyOfInheritedFrus(
-                l_fruPath, i_paramsToWriteData, l_sysCfgJsonObj);
-        }
-
-        return l_rc;
+        return l_results;
     }
     catch (const std::exception& l_exception)
     {
         // TODO:: error log needed
         logging::logMessage("Update keyword failed for file[" + i_vpdPath +
                             "], reason: " + std::string(l_exception.what()));
-        return -1;
+        return std::vector<int>(i_paramsToWriteData.size(),
+                                constants::FAILURE);
     }
 }
 
@@ -238,15 +328,18 @@ int Manager::updateKeywordOnHardware(
             throw std::runtime_error("Given FRU path is empty");
         }
 
-        nlohmann::json l_sysCfgJsonObj{};
+        std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+            std::make_shared<const nlohmann::json>();
+        std::shared_ptr<EepromWriteQueue> l_eepromWriteQueue;
 
         if (m_worker.get() != nullptr)
         {
             l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
+            l_eepromWriteQueue = m_worker->getEepromWriteQueue();
         }
 
-        std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(i_fruPath, l_sysCfgJsonObj);
+        std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
+            i_fruPath, l_sysCfgJsonObj, l_eepromWriteQueue);
         return l_parserObj->updateVpdKeywordOnHardware(i_paramsToWriteData);
     }
     catch (const std::exception& l_exception)
@@ -267,7 +360,8 @@ types::DbusVariantType Manager::readKeyword(
 {
     try
     {
-        nlohmann::json l_jsonObj{};
+        std::shared_ptr<const nlohmann::json> l_jsonObj =
+            std::make_shared<const nlohmann::json>();
 
         if (m_worker.get() != nullptr)
         {
@@ -285,6 +379,28 @@ types::DbusVariantType Manager::readKeyword(
 
         logging::logMessage("Performing VPD read on " + i_fruPath);
 
+        if (const types::IpzType* l_ipzData =
+                std::get_if<types::IpzType>(&i_paramsToReadData);
+            l_ipzData && std::get<0>(*l_ipzData) != "VHDR" &&
+            std::get<0>(*l_ipzData) != "VTOC")
+        {
+            // Try reading just the record holding the keyword, EEPROM is
+            // parsed as a whole only if that fails.
+            try
+            {
+                return types::DbusVariantType{m_pinnedKeyword.read(
+                    i_fruPath, std::get<0>(*l_ipzData),
+                    std::get<1>(*l_ipzData),
+                    jsonUtility::getVPDOffset(*l_jsonObj, i_fruPath))};
+            }
+            catch (const std::exception& l_ex)
+            {
+                logging::logMessage<logging::LogLevel::Debug>(
+                    "Direct keyword read failed for " + i_fruPath +
+                    ", error: " + std::string(l_ex.what()));
+            }
+        }
+
         std::shared_ptr<vpd::Parser> l_parserObj =
             std::make_shared<vpd::Parser>(i_fruPath, l_jsonObj);
 
@@ -303,17 +419,179 @@ types::DbusVariantType Manager::readKeyword(
     }
 }
 
-void Manager::collectSingleFruVpd(
-    const sdbusplus::message::object_path& i_dbusObjPath)
+types::ReadKeywordsResult Manager::readKeywords(
+    const types::Path i_fruPath,
+    const std::vector<types::IpzType> i_keywordsToRead)
 {
-    if (m_vpdCollectionStatus != "Completed")
+    std::shared_ptr<vpd::ParserInterface> l_vpdParserInstance;
+
+    try
+    {
+        std::shared_ptr<const nlohmann::json> l_jsonObj =
+            std::make_shared<const nlohmann::json>();
+
+        if (m_worker.get() != nullptr)
+        {
+            l_jsonObj = m_worker->getSysCfgJsonObj();
+        }
+
+        std::error_code ec;
+
+        // Check if given path is filesystem path
+        if (!std::filesystem::exists(i_fruPath, ec) && (ec))
+        {
+            throw std::runtime_error(
+                "Given file path " + i_fruPath + " not found.");
+        }
+
+        // EEPROM is read once here, all the keywords are served from it.
+        std::shared_ptr<vpd::Parser> l_parserObj =
+            std::make_shared<vpd::Parser>(i_fruPath, l_jsonObj);
+
+        l_vpdParserInstance = l_parserObj->getVpdParserInstance();
+    }
+    catch (const std::exception& l_ex)
     {
         logging::logMessage(
-            "Currently VPD CollectionStatus is not completed. Cannot perform single FRU VPD collection for " +
-            std::string(i_dbusObjPath));
-        return;
+            l_ex.what() +
+            std::string(". VPD manager read operation failed for ") +
+            i_fruPath);
+        throw types::DeviceError::ReadFailure();
     }
 
+    types::ReadKeywordsResult l_result;
+
+    for (const auto& l_recordKeyword : i_keywordsToRead)
+    {
+        const std::string l_keywordString = std::get<0>(l_recordKeyword) +
+                                            ":" + std::get<1>(l_recordKeyword);
+
+        try
+        {
+            const types::DbusVariantType l_value =
+                l_vpdParserInstance->readKeywordFromHardware(l_recordKeyword);
+
+            if (const auto l_binaryValue =
+                    std::get_if<types::BinaryVector>(&l_value))
+            {
+                l_result.insert_or_assign(
+                    l_keywordString, std::make_tuple(0, *l_binaryValue));
+            }
+            else
+            {
+                l_result.insert_or_assign(
+                    l_keywordString,
+                    std::make_tuple(EINVAL, types::BinaryVector{}));
+            }
+        }
+        catch (const types::DbusInvalidArgument&)
+        {
+            l_result.insert_or_assign(
+                l_keywordString,
+                std::make_tuple(EINVAL, types::BinaryVector{}));
+        }
+        catch (const std::exception& l_ex)
+        {
+            logging::logMessage("Read of " + l_keywordString + " failed for " +
+                                i_fruPath + ". Error: " + l_ex.what());
+
+            l_result.insert_or_assign(
+                l_keywordString, std::make_tuple(EIO, types::BinaryVector{}));
+        }
+    }
+
+    return l_result;
+}
+
+types::FruVpdMap Manager::getFruVpd(const types::Path i_vpdPath,
+                                    const bool i_readFromHardware)
+{
+    types::VPDMapVariant l_parsedVpd;
+
+    try
+    {
+        if (i_vpdPath.empty())
+        {
+            throw std::runtime_error("Given VPD path is empty.");
+        }
+
+        std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+            std::make_shared<const nlohmann::json>();
+
+        if (m_worker.get() != nullptr)
+        {
+            l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
+        }
+
+        const types::Path l_fruPath = getEepromPath(i_vpdPath);
+
+        if (!i_readFromHardware && m_worker.get() != nullptr)
+        {
+            if (auto l_cachedVpd = m_worker->getCachedParsedVpd(l_fruPath))
+            {
+                l_parsedVpd = std::move(*l_cachedVpd);
+            }
+        }
+
+        if (std::holds_alternative<std::monostate>(l_parsedVpd))
+        {
+            // Read before parsing, so that VPD parsed while the EEPROM is
+            // written to is not cached.
+            const uint64_t l_generation =
+                (m_worker.get() != nullptr)
+                    ? m_worker->getParsedVpdGeneration(l_fruPath)
+                    : 0;
+
+            std::shared_ptr<Parser> l_parserObj =
+                std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj);
+            l_parsedVpd = l_parserObj->parse();
+
+            if (m_worker.get() != nullptr)
+            {
+                m_worker->cacheParsedVpd(l_fruPath, l_parsedVpd, l_generation);
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage(
+            l_ex.what() +
+            std::string(". VPD manager get FRU VPD failed for ") + i_vpdPath);
+        throw types::DeviceError::ReadFailure();
+    }
+
+    if (const auto l_ipzVpdMap = std::get_if<types::IPZVpdMap>(&l_parsedVpd))
+    {
+        std::map<std::string, std::map<std::string, types::BinaryVector>>
+            l_recordMap;
+
+        for (const auto& [l_recordName, l_keywordMap] : *l_ipzVpdMap)
+        {
+            auto& l_keywordValueMap = l_recordMap[l_recordName];
+            for (const auto& [l_keywordName, l_value] : l_keywordMap)
+            {
+                l_keywordValueMap.emplace(
+                    l_keywordName,
+                    types::BinaryVector(l_value.begin(), l_value.end()));
+            }
+        }
+        return l_recordMap;
+    }
+
+    if (const auto l_kwdVpdMap =
+            std::get_if<types::KeywordVpdMap>(&l_parsedVpd))
+    {
+        return std::map<std::string, types::KWdVPDValueType>(
+            l_kwdVpdMap->begin(), l_kwdVpdMap->end());
+    }
+
+    logging::logMessage("No parsed VPD found for " + i_vpdPath);
+    throw types::DeviceError::ReadFailure();
+}
+
+void Manager::collectSingleFruVpd(
+    const sdbusplus::message::object_path& i_dbusObjPath)
+{
     if (m_worker.get() != nullptr)
     {
         m_worker->collectSingleFruVpd(i_dbusObjPath);
@@ -347,6 +625,24 @@ void Manager::deleteSingleFruVpd(
     }
 }
 
+types::Path Manager::getEepromPath(const types::Path& i_vpdPath) const
+{
+    types::Path l_fruPath;
+
+    if (m_worker.get() != nullptr && !i_vpdPath.empty())
+    {
+        const auto l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
+
+        if (!l_sysCfgJsonObj->empty())
+        {
+            l_fruPath =
+                jsonUtility::getFruPathFromJson(*l_sysCfgJsonObj, i_vpdPath);
+        }
+    }
+
+    return l_fruPath.empty() ? i_vpdPath : l_fruPath;
+}
+
 bool Manager::isValidUnexpandedLocationCode(
     const std::string& i_unexpandedLocationCode)
 {
@@ -378,14 +674,19 @@ std::string Manager::getExpandedLocationCode(
                 i_unexpandedLocationCode.c_str()));
     }
 
-    const nlohmann::json& l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-    if (!l_sysCfgJsonObj.contains("frus"))
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        m_worker->getSysCfgJsonObj();
+    if (!l_sysCfgJsonObj->contains("frus"))
     {
         logging::logMessage("Missing frus tag in system config JSON");
+        phosphor::logging::elog<types::DbusInvalidArgument>(
+            types::InvalidArgument::ARGUMENT_NAME("LOCATIONCODE"),
+            types::InvalidArgument::ARGUMENT_VALUE(
+                i_unexpandedLocationCode.c_str()));
     }
 
     const nlohmann::json& l_listOfFrus =
-        l_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
+        l_sysCfgJsonObj->at("frus").get_ref<const nlohmann::json::object_t&>();
 
     for (const auto& l_frus : l_listOfFrus.items())
     {
@@ -422,14 +723,19 @@ types::ListOfPaths Manager::getFrusByUnexpandedLocationCode(
                 i_unexpandedLocationCode.c_str()));
     }
 
-    const nlohmann::json& l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-    if (!l_sysCfgJsonObj.contains("frus"))
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        m_worker->getSysCfgJsonObj();
+    if (!l_sysCfgJsonObj->contains("frus"))
     {
         logging::logMessage("Missing frus tag in system config JSON");
+        phosphor::logging::elog<types::DbusInvalidArgument>(
+            types::InvalidArgument::ARGUMENT_NAME("LOCATIONCODE"),
+            types::InvalidArgument::ARGUMENT_VALUE(
+                i_unexpandedLocationCode.c_str()));
     }
 
     const nlohmann::json& l_listOfFrus =
-        l_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
+        l_sysCfgJsonObj->at("frus").get_ref<const nlohmann::json::object_t&>();
 
     for (const auto& l_frus : l_listOfFrus.items())
     {
@@ -486,14 +792,32 @@ std::tuple<std::string, uint16_t> Manager::getUnexpandedLocationCode(
 
     std::string l_fcKwd;
 
-    auto l_fcKwdValue = dbusUtility::readDbusProperty(
-        "xyz.openbmc_project.Inventory.Manager",
-        "/xyz/openbmc_project/inventory/system/chassis/motherboard",
-        "com.ibm.ipzvpd.VCEN", "FC");
+    if (m_worker.get() != nullptr)
+    {
+        const types::IPZVpdMap& l_sysKwdCache =
+            m_worker->getCachedSystemKeywords();
+
+        if (auto l_itrToVcen = l_sysKwdCache.find(constants::recVCEN);
+            l_itrToVcen != l_sysKwdCache.end())
+        {
+            l_fcKwd = l_itrToVcen->second.contains(constants::kwdFC)
+                          ? l_itrToVcen->second.at(constants::kwdFC)
+                          : std::string{};
+        }
+    }
 
-    if (auto l_kwdValue = std::get_if<types::BinaryVector>(&l_fcKwdValue))
+    if (l_fcKwd.empty())
     {
-        l_fcKwd.assign(l_kwdValue->begin(), l_kwdValue->end());
+        // System VPD not cached, read it from D-Bus.
+        auto l_fcKwdValue = dbusUtility::readDbusProperty(
+            "xyz.openbmc_project.Inventory.Manager",
+            "/xyz/openbmc_project/inventory/system/chassis/motherboard",
+            "com.ibm.ipzvpd.VCEN", "FC");
+
+        if (auto l_kwdValue = std::get_if<types::BinaryVector>(&l_fcKwdValue))
+        {
+            l_fcKwd.assign(l_kwdValue->begin(), l_kwdValue->end());
+        }
     }
 
     // Get the first part of expanded location code to check for FC or TM.
@@ -1,6 +1,7 @@
 #include "parser.hpp"
 
 #include "constants.hpp"
+#include "eeprom_write_queue.hpp"
 #include "event_logger.hpp"
 
 #include <utility/dbus_utility.hpp>
@@ -8,11 +9,24 @@
 #include <utility/vpd_specific_utility.hpp>
 
 #include <fstream>
+#include <future>
 
 namespace vpd
 {
-Parser::Parser(const std::string& vpdFilePath, nlohmann::json parsedJson) :
-    m_vpdFilePath(vpdFilePath), m_parsedJson(parsedJson)
+Parser::Parser(const std::string& vpdFilePath,
+               const nlohmann::json& parsedJson,
+               std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue) :
+    Parser(vpdFilePath, std::make_shared<const nlohmann::json>(parsedJson),
+           std::move(i_eepromWriteQueue))
+{}
+
+Parser::Parser(const std::string& vpdFilePath,
+               std::shared_ptr<const nlohmann::json> parsedJson,
+               std::shared_ptr<EepromWriteQueue> i_eepromWriteQueue) :
+    m_vpdFilePath(vpdFilePath),
+    m_parsedJson(parsedJson ? std::move(parsedJson)
+                            : std::make_shared<const nlohmann::json>()),
+    m_eepromWriteQueue(std::move(i_eepromWriteQueue))
 {
     std::error_code l_errCode;
 
@@ -32,9 +46,10 @@ Parser::Parser(const std::string& vpdFilePath, nlohmann::json parsedJson) :
     }
 
     // Read VPD offset if applicable.
-    if (!m_parsedJson.empty())
+    if (!m_parsedJson->empty())
     {
-        m_vpdStartOffset = jsonUtility::getVPDOffset(m_parsedJson, vpdFilePath);
+        m_vpdStartOffset =
+            jsonUtility::getVPDOffset(*m_parsedJson, vpdFilePath);
     }
 }
 
@@ -57,24 +72,70 @@ types::VPDMapVariant Parser::parse()
     return l_parser->parse();
 }
 
+int Parser::writeKeywordThroughQueue(
+    const types::WriteVpdParams& i_paramsToWriteData)
+{
+    const types::WriteResult l_result =
+        writeKeywordsThroughQueue({i_paramsToWriteData}).front();
+
+    if (!l_result.has_value())
+    {
+        std::rethrow_exception(l_result.error());
+    }
+    return l_result.value();
+}
+
+std::vector<types::WriteResult> Parser::writeKeywordsThroughQueue(
+    const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+{
+    if (!m_eepromWriteQueue)
+    {
+        return getVpdParserInstance()->writeKeywordsOnHardware(
+            i_paramsToWriteData);
+    }
+
+    return m_eepromWriteQueue->writeBatch(
+        m_vpdFilePath, m_vpdStartOffset, i_paramsToWriteData,
+        [this](const std::vector<types::WriteVpdParams>& i_batch) {
+            // Read VPD afresh, so that the batch is applied on latest data.
+            return getVpdParserInstance()->writeKeywordsOnHardware(i_batch);
+        });
+}
+
 int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
 {
-    int l_bytesUpdatedOnHardware = constants::FAILURE;
+    return updateVpdKeywords({i_paramsToWriteData}).front();
+}
+
+std::vector<int> Parser::updateVpdKeywords(
+    const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+{
+    std::vector<int> l_bytesUpdatedOnHardware(i_paramsToWriteData.size(),
+                                              constants::FAILURE);
 
     // A lambda to extract Record : Keyword string from i_paramsToWriteData
     auto l_keyWordIdentifier =
-        [](const types::WriteVpdParams& i_paramsToWriteData) -> std::string {
+        [](const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
+        -> std::string {
         std::string l_keywordString{};
-        if (const types::IpzData* l_ipzData =
-                std::get_if<types::IpzData>(&i_paramsToWriteData))
+        for (const auto& l_paramsToWriteData : i_paramsToWriteData)
         {
-            l_keywordString =
-                std::get<0>(*l_ipzData) + ":" + std::get<1>(*l_ipzData);
-        }
-        else if (const types::KwData* l_kwData =
-                     std::get_if<types::KwData>(&i_paramsToWriteData))
-        {
-            l_keywordString = std::get<0>(*l_kwData);
+            if (!l_keywordString.empty())
+            {
+                l_keywordString += ", ";
+            }
+
+            if (const types::IpzData* l_ipzData =
+                    std::get_if<types::IpzData>(&l_paramsToWriteData))
+            {
+                l_keywordString +=
+                    std::get<0>(*l_ipzData) + ":" + std::get<1>(*l_ipzData);
+            }
+            else if (const types::KwData* l_kwData =
+                         std::get_if<types::KwData>(&l_paramsToWriteData))
+            {
+                l_keywordString += std::get<0>(*l_kwData);
+            }
         }
         return l_keywordString;
     };
@@ -92,63 +153,119 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
                     l_keyWordIdentifier(i_paramsToWriteData)),
                 std::nullopt, std::nullopt, std::nullopt, std::nullopt);
 
-            return constants::FAILURE;
+            return l_bytesUpdatedOnHardware;
         }
 
-        // Update keyword's value on hardware
-        try
-        {
-            std::shared_ptr<ParserInterface> l_vpdParserInstance =
-                getVpdParserInstance();
-            l_bytesUpdatedOnHardware =
-                l_vpdParserInstance->writeKeywordOnHardware(
-                    i_paramsToWriteData);
-        }
-        catch (const std::exception& l_exception)
+        const auto [l_fruPath, l_inventoryObjPath, l_redundantFruPath] =
+            jsonUtility::getAllPathsToUpdateKeyword(*m_parsedJson,
+                                                    m_vpdFilePath);
+
+        // Update keywords' value on hardware
+        const std::vector<types::WriteResult> l_writeResults =
+            writeKeywordsThroughQueue(i_paramsToWriteData);
+
+        // Index of the keywords which got updated on hardware. Rest are
+        // reported as failed, and not taken further.
+        std::vector<size_t> l_writtenIndexes;
+        std::vector<types::WriteVpdParams> l_writtenParams;
+
+        for (size_t l_index = 0; l_index < l_writeResults.size(); ++l_index)
         {
-            std::string l_errMsg(
-                "Error while updating keyword's value on hardware path " +
-                m_vpdFilePath + ", error: " + std::string(l_exception.what()));
+            if (l_writeResults[l_index].has_value())
+            {
+                l_bytesUpdatedOnHardware[l_index] =
+                    l_writeResults[l_index].value();
+                l_writtenIndexes.push_back(l_index);
+                l_writtenParams.push_back(i_paramsToWriteData[l_index]);
+                continue;
+            }
 
-            // TODO : Log PEL
+            try
+            {
+                std::rethrow_exception(l_writeResults[l_index].error());
+            }
+            catch (const std::exception& l_exception)
+            {
+                // TODO : Log PEL
+                logging::logMessage(
+                    "Error while updating " +
+                    l_keyWordIdentifier({i_paramsToWriteData[l_index]}) +
+                    " on hardware path " + m_vpdFilePath +
+                    ", error: " + std::string(l_exception.what()));
+            }
+        }
 
-            throw std::runtime_error(l_errMsg);
+        if (l_writtenIndexes.empty())
+        {
+            throw std::runtime_error(
+                "None of the keywords got updated on hardware path " +
+                m_vpdFilePath);
         }
 
-        auto [l_fruPath, l_inventoryObjPath, l_redundantFruPath] =
-            jsonUtility::getAllPathsToUpdateKeyword(m_parsedJson,
-                                                    m_vpdFilePath);
+        // Update keywords' value on redundant hardware if present. Started
+        // only once primary EEPROM is updated, and only for the keywords
+        // updated on it, so that the redundant EEPROM is never ahead of the
+        // primary. Redundant EEPROM is generally on a different bus, so it is
+        // written alongside the read back and D-Bus update below. Result is
+        // checked once D-Bus is updated, and the future waits for the write
+        // on destruction if anything in between throws.
+        std::future<int> l_redundantPathUpdate;
+        if (!l_redundantFruPath.empty())
+        {
+            l_redundantPathUpdate = std::async(
+                std::launch::async,
+                [this, l_redundantFruPath,
+                 l_writtenParams = std::move(l_writtenParams)]() {
+                    return updateVpdKeywordOnRedundantPath(l_redundantFruPath,
+                                                           l_writtenParams);
+                });
+        }
 
-        // If inventory D-bus object path is present, update keyword's value on
-        // DBus
+        // If inventory D-bus object path is present, update keywords' value on
+        // DBus, for the FRU, its inherited FRUs and common interfaces, in one
+        // go.
         if (!l_inventoryObjPath.empty())
         {
-            types::Record l_recordName;
-            std::string l_interfaceName;
-            std::string l_propertyName;
-            types::DbusVariantType l_keywordValue;
+            types::ObjectMap l_dbusObjMap;
+            std::shared_ptr<ParserInterface> l_vpdParserInstance;
 
-            if (const types::IpzData* l_ipzData =
-                    std::get_if<types::IpzData>(&i_paramsToWriteData))
+            for (const size_t l_index : l_writtenIndexes)
             {
-                l_recordName = std::get<0>(*l_ipzData);
-                l_interfaceName = constants::ipzVpdInf + l_recordName;
-                l_propertyName = std::get<1>(*l_ipzData);
+                const types::IpzData* l_ipzData =
+                    std::get_if<types::IpzData>(&i_paramsToWriteData[l_index]);
+
+                if (!l_ipzData)
+                {
+                    // Input parameter type provided isn't compatible to
+                    // perform update.
+                    logging::logMessage(
+                        "Input parameter type isn't compatible to update keyword's value on DBus for object path: " +
+                        l_inventoryObjPath);
+
+                    l_bytesUpdatedOnHardware[l_index] = constants::FAILURE;
+                    continue;
+                }
+
+                const types::Record& l_recordName = std::get<0>(*l_ipzData);
+                const types::Keyword& l_keywordName = std::get<1>(*l_ipzData);
+                types::DbusVariantType l_keywordValue;
 
                 try
                 {
                     // Read keyword's value from hardware to write the same on
-                    // D-bus.
-                    std::shared_ptr<ParserInterface> l_vpdParserInstance =
-                        getVpdParserInstance();
+                    // D-bus. VPD is read once for all the keywords.
+                    if (!l_vpdParserInstance)
+                    {
+                        l_vpdParserInstance = getVpdParserInstance();
 
-                    logging::logMessage(
-                        "Performing VPD read on " + m_vpdFilePath);
+                        logging::logMessage(
+                            "Performing VPD read on " + m_vpdFilePath);
+                    }
 
                     l_keywordValue =
                         l_vpdParserInstance->readKeywordFromHardware(
                             types::ReadVpdParams(
-                                std::make_tuple(l_recordName, l_propertyName)));
+                                std::make_tuple(l_recordName, l_keywordName)));
                 }
                 catch (const std::exception& l_exception)
                 {
@@ -162,30 +279,49 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
 
                     throw std::runtime_error(l_errMsg);
                 }
-            }
-            else
-            {
-                // Input parameter type provided isn't compatible to perform
-                // update.
-                std::string l_errMsg(
-                    "Input parameter type isn't compatible to update keyword's value on DBus for object path: " +
-                    l_inventoryObjPath);
-                throw std::runtime_error(l_errMsg);
-            }
 
-            // Get D-bus name for the given keyword
-            l_propertyName =
-                vpdSpecificUtility::getDbusPropNameForGivenKw(l_propertyName);
+                const auto l_binaryValue =
+                    std::get_if<types::BinaryVector>(&l_keywordValue);
+
+                const types::ObjectMap l_keywordObjMap =
+                    l_binaryValue
+                        ? vpdSpecificUtility::getKeywordUpdateObjectMap(
+                              l_fruPath,
+                              types::IpzData(l_recordName, l_keywordName,
+                                             *l_binaryValue),
+                              *m_parsedJson)
+                        : types::ObjectMap{};
+
+                if (l_keywordObjMap.empty())
+                {
+                    logging::logMessage(
+                        "Failed to get D-Bus updates of " + l_recordName + ":" +
+                        l_keywordName + " for object path: " +
+                        l_inventoryObjPath);
 
-            // Create D-bus object map
-            types::ObjectMap l_dbusObjMap = {std::make_pair(
-                l_inventoryObjPath,
-                types::InterfaceMap{std::make_pair(
-                    l_interfaceName, types::PropertyMap{std::make_pair(
-                                         l_propertyName, l_keywordValue)})})};
+                    l_bytesUpdatedOnHardware[l_index] = constants::FAILURE;
+                    continue;
+                }
+
+                // Merge with updates of other keywords.
+                for (const auto& [l_objectPath, l_interfaceMap] :
+                     l_keywordObjMap)
+                {
+                    for (const auto& [l_interface, l_propertyMap] :
+                         l_interfaceMap)
+                    {
+                        for (const auto& [l_property, l_value] : l_propertyMap)
+                        {
+                            l_dbusObjMap[l_objectPath][l_interface]
+                                .insert_or_assign(l_property, l_value);
+                        }
+                    }
+                }
+            }
 
             // Call PIM's Notify method to perform update
-            if (!dbusUtility::callPIM(std::move(l_dbusObjMap)))
+            if (!l_dbusObjMap.empty() &&
+                !dbusUtility::callPIM(std::move(l_dbusObjMap)))
             {
                 // Call to PIM's Notify method failed.
                 std::string l_errMsg("Notify PIM is failed for object path: " +
@@ -194,17 +330,13 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
             }
         }
 
-        // Update keyword's value on redundant hardware if present
-        if (!l_redundantFruPath.empty())
+        // Check update of keywords' value on redundant hardware if present
+        if (l_redundantPathUpdate.valid() && l_redundantPathUpdate.get() < 0)
         {
-            if (updateVpdKeywordOnRedundantPath(l_redundantFruPath,
-                                                i_paramsToWriteData) < 0)
-            {
-                std::string l_errMsg(
-                    "Error while updating keyword's value on redundant path " +
-                    l_redundantFruPath);
-                throw std::runtime_error(l_errMsg);
-            }
+            std::string l_errMsg(
+                "Error while updating keyword's value on redundant path " +
+                l_redundantFruPath);
+            throw std::runtime_error(l_errMsg);
         }
 
         // TODO: Check if revert is required when any of the writes fails.
@@ -216,8 +348,10 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
                             l_keyWordIdentifier(i_paramsToWriteData) +
                             " failed due to error: " + l_ex.what());
 
-        // update failed, set return value to failure
-        l_bytesUpdatedOnHardware = constants::FAILURE;
+        // Failure past hardware update affects all the keywords written, set
+        // return value to failure
+        std::fill(l_bytesUpdatedOnHardware.begin(),
+                  l_bytesUpdatedOnHardware.end(), constants::FAILURE);
     }
 
     // Disable Reboot Guard
@@ -236,21 +370,27 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
 
 int Parser::updateVpdKeywordOnRedundantPath(
     const std::string& i_fruPath,
-    const types::WriteVpdParams& i_paramsToWriteData)
+    const std::vector<types::WriteVpdParams>& i_paramsToWriteData)
 {
     try
     {
         std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(i_fruPath, m_parsedJson);
+            std::make_shared<Parser>(i_fruPath, m_parsedJson,
+                                     m_eepromWriteQueue);
 
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            l_parserObj->getVpdParserInstance();
-
-        return l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+        for (const auto& l_writeResult :
+             l_parserObj->writeKeywordsThroughQueue(i_paramsToWriteData))
+        {
+            if (!l_writeResult.has_value())
+            {
+                std::rethrow_exception(l_writeResult.error());
+            }
+        }
+        return constants::SUCCESS;
     }
     catch (const std::exception& l_exception)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             types::ErrorType::InvalidVpdMessage,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
             "Error while updating keyword's value on redundant path " +
@@ -299,10 +439,8 @@ int Parser::updateVpdKeywordOnHardware(
             return constants::FAILURE;
         }
 
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            getVpdParserInstance();
         l_bytesUpdatedOnHardware =
-            l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+            writeKeywordThroughQueue(i_paramsToWriteData);
     }
     catch (const std::exception& l_exception)
     {
@@ -0,0 +1,358 @@
+#include "pinned_keyword.hpp"
+
+#include "vpdecc/vpdecc.h"
+
+#include "constants.hpp"
+#include "event_logger.hpp"
+#include "exceptions.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace vpd
+{
+// Offset of VTOC pointer in VHDR, followed by VTOC length, VTOC ECC offset
+// and VTOC ECC length.
+static constexpr size_t VTOC_PTR_OFFSET = 35;
+static constexpr size_t VTOC_PTR_LENGTH = 8;
+
+// Offset of record name w.r.t. start of a record, keywords follow the name.
+static constexpr size_t RECORD_NAME_OFFSET = 6;
+static constexpr size_t RECORD_NAME_LENGTH = 4;
+static constexpr size_t KW_NAME_LENGTH = 2;
+
+// Size of a record's entry in VTOC PT keyword, and offset of record offset in
+// the entry, followed by record length, ECC offset and ECC length.
+static constexpr size_t PT_ENTRY_LENGTH = 14;
+static constexpr size_t PT_ENTRY_RECORD_OFFSET = 6;
+
+// Largest gap between a block and its ECC to read both with a single read.
+static constexpr size_t MAX_ECC_READ_GAP = 256;
+
+/**
+ * @brief API to read 2 bytes LE data.
+ *
+ * @param[in] i_data - Data.
+ * @param[in] i_offset - Offset to read at.
+ *
+ * @throw DataException if the data is too short.
+ *
+ * @return read bytes.
+ */
+static uint16_t readUInt16LE(const types::BinaryVector& i_data,
+                             size_t i_offset)
+{
+    if (i_offset + sizeof(uint16_t) > i_data.size())
+    {
+        throw DataException("Offset out of range of VPD data.");
+    }
+    return static_cast<uint16_t>(i_data[i_offset] |
+                                 (i_data[i_offset + 1] << 8));
+}
+
+/**
+ * @brief API to get name of a record.
+ *
+ * @param[in] i_record - Record.
+ *
+ * @return Record name, empty if the record is too short.
+ */
+static std::string getRecordName(const types::BinaryVector& i_record)
+{
+    if (i_record.size() < RECORD_NAME_OFFSET + RECORD_NAME_LENGTH)
+    {
+        return std::string{};
+    }
+    return std::string(i_record.begin() + RECORD_NAME_OFFSET,
+                       i_record.begin() + RECORD_NAME_OFFSET +
+                           RECORD_NAME_LENGTH);
+}
+
+/**
+ * @brief API to find a keyword's value in a record.
+ *
+ * @param[in] i_record - Record.
+ * @param[in] i_keywordName - Keyword name.
+ *
+ * @throw DataException if the keyword is not found.
+ *
+ * @return Offset of the value w.r.t. start of the record and its length.
+ */
+static std::pair<size_t, size_t> findKeyword(
+    const types::BinaryVector& i_record, const types::Keyword& i_keywordName)
+{
+    size_t l_offset = RECORD_NAME_OFFSET + RECORD_NAME_LENGTH;
+
+    while (l_offset + KW_NAME_LENGTH < i_record.size())
+    {
+        const std::string l_kwName(i_record.begin() + l_offset,
+                                   i_record.begin() + l_offset +
+                                       KW_NAME_LENGTH);
+        if (l_kwName == constants::LAST_KW)
+        {
+            break;
+        }
+        l_offset += KW_NAME_LENGTH;
+
+        size_t l_kwdDataLength = 0;
+        if (constants::POUND_KW == l_kwName.front())
+        {
+            l_kwdDataLength = readUInt16LE(i_record, l_offset);
+            l_offset += sizeof(types::PoundKwSize);
+        }
+        else
+        {
+            l_kwdDataLength = i_record.at(l_offset);
+            l_offset += sizeof(types::KwSize);
+        }
+
+        if (l_offset + l_kwdDataLength > i_record.size())
+        {
+            break;
+        }
+
+        if (l_kwName == i_keywordName)
+        {
+            return {l_offset, l_kwdDataLength};
+        }
+        l_offset += l_kwdDataLength;
+    }
+
+    throw DataException("Keyword " + i_keywordName + " not found.");
+}
+
+/**
+ * @brief API to check a block of VPD against its ECC.
+ *
+ * @param[in,out] io_data - Data, corrected if it has a correctable error.
+ * @param[in] i_ecc - ECC of the data.
+ * @param[in] i_vpdFilePath - EEPROM path, for logging.
+ * @param[in] i_dataOffset - Offset of the data, for logging.
+ *
+ * @throw EccException if ECC check fails.
+ */
+static void checkEcc(types::BinaryVector& io_data,
+                     const types::BinaryVector& i_ecc,
+                     const std::string& i_vpdFilePath, size_t i_dataOffset)
+{
+    if (io_data.empty() || i_ecc.empty())
+    {
+        throw EccException("Invalid data or ECC length.");
+    }
+
+    const auto l_status = vpdecc_check_data(io_data.data(), io_data.size(),
+                                            i_ecc.data(), i_ecc.size());
+
+    if (l_status == VPD_ECC_CORRECTABLE_DATA)
+    {
+        EventLogger::createQueuedPel(
+            types::ErrorType::EccCheckFailed,
+            types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
+            "One bit correction performed for VPD at offset " +
+                std::to_string(i_dataOffset) + " of " + i_vpdFilePath,
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+    }
+    else if (l_status != VPD_ECC_OK)
+    {
+        throw EccException("ECC check failed for VPD at offset " +
+                           std::to_string(i_dataOffset) + " of " +
+                           i_vpdFilePath);
+    }
+}
+
+types::BinaryVector PinnedKeyword::read(
+    const std::string& i_vpdFilePath, const types::Record& i_recordName,
+    const types::Keyword& i_keywordName, size_t i_vpdStartOffset)
+{
+    std::unique_ptr<FILE, decltype(&fclose)> l_file(
+        fopen(i_vpdFilePath.c_str(), "rbe"), fclose);
+    if (!l_file)
+    {
+        throw std::runtime_error("Failed to open " + i_vpdFilePath +
+                                 ", error: " + std::strerror(errno));
+    }
+    const int l_fd = fileno(l_file.get());
+
+    const types::BinaryVector l_vtocPtr =
+        readBytes(l_fd, i_vpdStartOffset + VTOC_PTR_OFFSET, VTOC_PTR_LENGTH);
+    const types::RecordOffset l_vtocOffset = readUInt16LE(l_vtocPtr, 0);
+    const types::RecordLength l_vtocLength = readUInt16LE(l_vtocPtr, 2);
+    const types::ECCOffset l_vtocEccOffset = readUInt16LE(l_vtocPtr, 4);
+    const types::ECCLength l_vtocEccLength = readUInt16LE(l_vtocPtr, 6);
+
+    // ECC of VTOC changes with VTOC, so VTOC itself need not be read to tell
+    // if it changed. Fingerprint covers the pointer too, VTOC may move as a
+    // whole.
+    const types::BinaryVector l_vtocEcc = readBytes(
+        l_fd, i_vpdStartOffset + l_vtocEccOffset, l_vtocEccLength);
+
+    std::string l_vtocBytes(l_vtocPtr.begin(), l_vtocPtr.end());
+    l_vtocBytes.append(l_vtocEcc.begin(), l_vtocEcc.end());
+    const size_t l_vtocFingerprint = std::hash<std::string>{}(l_vtocBytes);
+
+    const std::string l_key =
+        i_vpdFilePath + ':' + i_recordName + ':' + i_keywordName;
+
+    Location l_location;
+    bool l_isPinned = false;
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        const auto l_itrToLocation = m_locations.find(l_key);
+        if (l_itrToLocation != m_locations.end() &&
+            l_itrToLocation->second.m_vtocFingerprint == l_vtocFingerprint)
+        {
+            l_location = l_itrToLocation->second;
+            l_isPinned = true;
+        }
+    }
+
+    if (!l_isPinned)
+    {
+        // VTOC is new or changed, locate the keyword from an ECC checked VTOC.
+        types::BinaryVector l_vtoc =
+            readBytes(l_fd, i_vpdStartOffset + l_vtocOffset, l_vtocLength);
+        checkEcc(l_vtoc, l_vtocEcc, i_vpdFilePath,
+                 i_vpdStartOffset + l_vtocOffset);
+
+        l_location = locate(l_fd, i_vpdFilePath, l_vtoc, i_recordName,
+                            i_keywordName, i_vpdStartOffset);
+        l_location.m_vtocFingerprint = l_vtocFingerprint;
+    }
+
+    // ECC of a record is computed over the whole record, so the whole record
+    // is read to check the keyword's value.
+    const types::BinaryVector l_record = readEccCheckedBlock(
+        l_fd, i_vpdFilePath, i_vpdStartOffset + l_location.m_recordOffset,
+        l_location.m_recordLength, i_vpdStartOffset + l_location.m_eccOffset,
+        l_location.m_eccLength);
+
+    if (getRecordName(l_record) != i_recordName ||
+        l_location.m_valueOffset + l_location.m_valueLength > l_record.size())
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_locations.erase(l_key);
+
+        throw DataException("Record " + i_recordName +
+                            " not found at its offset in " + i_vpdFilePath);
+    }
+
+    if (!l_isPinned)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_locations.insert_or_assign(l_key, l_location);
+    }
+
+    return types::BinaryVector(
+        l_record.begin() + l_location.m_valueOffset,
+        l_record.begin() + l_location.m_valueOffset + l_location.m_valueLength);
+}
+
+PinnedKeyword::Location PinnedKeyword::locate(
+    int i_fd, const std::string& i_vpdFilePath,
+    const types::BinaryVector& i_vtoc, const types::Record& i_recordName,
+    const types::Keyword& i_keywordName, size_t i_vpdStartOffset)
+{
+    if (getRecordName(i_vtoc) != "VTOC")
+    {
+        throw DataException("VTOC not found at its offset.");
+    }
+
+    const auto [l_ptOffset, l_ptLength] = findKeyword(i_vtoc, "PT");
+
+    Location l_location;
+    for (size_t l_entry = l_ptOffset;
+         l_entry + PT_ENTRY_LENGTH <= l_ptOffset + l_ptLength;
+         l_entry += PT_ENTRY_LENGTH)
+    {
+        if (std::string(i_vtoc.begin() + l_entry,
+                        i_vtoc.begin() + l_entry + RECORD_NAME_LENGTH) !=
+            i_recordName)
+        {
+            continue;
+        }
+
+        const size_t l_fieldOffset = l_entry + PT_ENTRY_RECORD_OFFSET;
+        l_location.m_recordOffset = readUInt16LE(i_vtoc, l_fieldOffset);
+        l_location.m_recordLength = readUInt16LE(i_vtoc, l_fieldOffset + 2);
+        l_location.m_eccOffset = readUInt16LE(i_vtoc, l_fieldOffset + 4);
+        l_location.m_eccLength = readUInt16LE(i_vtoc, l_fieldOffset + 6);
+        break;
+    }
+
+    if (l_location.m_recordOffset == 0 || l_location.m_recordLength == 0)
+    {
+        throw DataException("Record " + i_recordName + " not found in VTOC.");
+    }
+
+    const types::BinaryVector l_record = readEccCheckedBlock(
+        i_fd, i_vpdFilePath, i_vpdStartOffset + l_location.m_recordOffset,
+        l_location.m_recordLength, i_vpdStartOffset + l_location.m_eccOffset,
+        l_location.m_eccLength);
+
+    std::tie(l_location.m_valueOffset, l_location.m_valueLength) =
+        findKeyword(l_record, i_keywordName);
+
+    return l_location;
+}
+
+types::BinaryVector PinnedKeyword::readBytes(int i_fd, size_t i_offset,
+                                             size_t i_length)
+{
+    types::BinaryVector l_data(i_length);
+    if (pread(i_fd, l_data.data(), i_length, static_cast<off_t>(i_offset)) !=
+        static_cast<ssize_t>(i_length))
+    {
+        throw std::runtime_error("Failed to read " + std::to_string(i_length) +
+                                 " bytes of VPD at offset " +
+                                 std::to_string(i_offset));
+    }
+    return l_data;
+}
+
+types::BinaryVector PinnedKeyword::readEccCheckedBlock(
+    int i_fd, const std::string& i_vpdFilePath, size_t i_dataOffset,
+    size_t i_dataLength, size_t i_eccOffset, size_t i_eccLength)
+{
+    if (i_dataLength == 0 || i_eccLength == 0)
+    {
+        throw EccException("Invalid data or ECC length.");
+    }
+
+    types::BinaryVector l_data;
+    types::BinaryVector l_ecc;
+
+    const size_t l_spanStart = std::min(i_dataOffset, i_eccOffset);
+    const size_t l_spanEnd =
+        std::max(i_dataOffset + i_dataLength, i_eccOffset + i_eccLength);
+
+    if (l_spanEnd - l_spanStart <=
+        i_dataLength + i_eccLength + MAX_ECC_READ_GAP)
+    {
+        // Data and ECC are close, read both at once.
+        const types::BinaryVector l_span =
+            readBytes(i_fd, l_spanStart, l_spanEnd - l_spanStart);
+
+        const auto l_itrToData = l_span.begin() + (i_dataOffset - l_spanStart);
+        l_data.assign(l_itrToData, l_itrToData + i_dataLength);
+
+        const auto l_itrToEcc = l_span.begin() + (i_eccOffset - l_spanStart);
+        l_ecc.assign(l_itrToEcc, l_itrToEcc + i_eccLength);
+    }
+    else
+    {
+        l_data = readBytes(i_fd, i_dataOffset, i_dataLength);
+        l_ecc = readBytes(i_fd, i_eccOffset, i_eccLength);
+    }
+
+    checkEcc(l_data, l_ecc, i_vpdFilePath, i_dataOffset);
+    return l_data;
+}
+} // namespace vpd
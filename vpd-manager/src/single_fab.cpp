@@ -6,6 +6,7 @@
 #include "event_logger.hpp"
 #include "parser.hpp"
 #include "types.hpp"
+#include "uboot_env.hpp"
 
 #include <nlohmann/json.hpp>
 #include <utility/common_utility.hpp>
@@ -16,8 +17,6 @@ namespace vpd
 {
 constexpr auto pimPersistVsbpPath =
     "/var/lib/phosphor-inventory-manager/xyz/openbmc_project/inventory/system/chassis/motherboard/com.ibm.ipzvpd.VSBP";
-constexpr auto IM_SIZE_IN_BYTES = 0x04;
-constexpr auto IM_KW_VALUE_OFFSET = 0x000005fb;
 
 std::string SingleFab::getImFromPersistedLocation() const noexcept
 {
@@ -55,21 +54,14 @@ std::string SingleFab::getImFromPlanar() const noexcept
 {
     try
     {
-        const std::string l_systemPlanarPath(SYSTEM_VPD_FILE_PATH);
-        Parser l_parserObj(l_systemPlanarPath, nlohmann::json{});
+        // Only VTOC and VSBP record are read, instead of the whole EEPROM.
+        const types::BinaryVector l_keywordValue = m_pinnedKeyword.read(
+            SYSTEM_VPD_FILE_PATH, constants::recVSBP, constants::kwdIM);
 
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            l_parserObj.getVpdParserInstance();
-
-        auto l_readValue = l_vpdParserInstance->readKeywordFromHardware(
-            std::make_tuple(constants::recVSBP, constants::kwdIM));
-
-        if (auto l_keywordValue =
-                std::get_if<types::BinaryVector>(&l_readValue);
-            l_keywordValue && !l_keywordValue->empty())
+        if (!l_keywordValue.empty())
         {
             std::ostringstream l_imData;
-            for (const auto& l_byte : *l_keywordValue)
+            for (const auto& l_byte : l_keywordValue)
             {
                 l_imData << std::setw(2) << std::setfill('0') << std::hex
                          << static_cast<int>(l_byte);
@@ -78,8 +70,11 @@ std::string SingleFab::getImFromPlanar() const noexcept
             return l_imData.str();
         }
     }
-    catch (const std::ifstream::failure& l_ex)
-    {}
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to read IM from planar, error: " +
+                            std::string(l_ex.what()));
+    }
 
     return std::string();
 }
@@ -99,8 +94,9 @@ bool SingleFab::setImOnPlanar(const std::string& i_imValue) const noexcept
                 static_cast<uint8_t>(std::stoi(l_byteString, nullptr, 16)));
         }
 
-        std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
-            l_systemPlanarEepromPath, nlohmann::json{});
+        const nlohmann::json l_emptyJson{};
+        std::shared_ptr<Parser> l_parserObj =
+            std::make_shared<Parser>(l_systemPlanarEepromPath, l_emptyJson);
 
         int l_bytes_updated = l_parserObj->updateVpdKeywordOnHardware(
             std::make_tuple(constants::recVSBP, constants::kwdIM, l_imValue));
@@ -117,18 +113,12 @@ bool SingleFab::isFieldModeEnabled() const noexcept
 {
     try
     {
-        std::vector<std::string> l_cmdOutput =
-            commonUtility::executeCmd("/sbin/fw_printenv fieldmode");
-
-        if (l_cmdOutput.size() > 0)
-        {
-            commonUtility::toLower(l_cmdOutput[0]);
+        // Cached by UBootEnv for lifetime of the object, field mode enabled
+        // with fw_setenv by another process is not seen till a restart.
+        std::string l_fieldMode = m_uBootEnv.getValue("fieldmode");
+        commonUtility::toLower(l_fieldMode);
 
-            // Remove the new line character from the string.
-            l_cmdOutput[0].erase(l_cmdOutput[0].length() - 1);
-
-            return l_cmdOutput[0] == "fieldmode=true" ? true : false;
-        }
+        return l_fieldMode == "true";
     }
     catch (const std::exception& l_ex)
     {}
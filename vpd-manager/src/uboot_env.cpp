@@ -0,0 +1,458 @@
+#include "uboot_env.hpp"
+
+#include "constants.hpp"
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <mtd/mtd-user.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace vpd
+{
+// Size of CRC at the start of each copy.
+static constexpr size_t crcSize = sizeof(uint32_t);
+
+// Flags of copies on flash, where a flag can be cleared without an erase.
+static constexpr uint8_t activeFlag = 1;
+static constexpr uint8_t obsoleteFlag = 0;
+
+/**
+ * @brief API to check if a copy is on MTD flash.
+ *
+ * @param[in] i_device - Device of the copy.
+ *
+ * @return true if on MTD, false otherwise.
+ */
+static bool isMtdDevice(const std::string& i_device)
+{
+    return i_device.starts_with("/dev/mtd");
+}
+
+/**
+ * @brief File descriptor closed when going out of scope.
+ */
+struct ScopedFd
+{
+    explicit ScopedFd(int i_fd) : m_fd(i_fd) {}
+    ~ScopedFd()
+    {
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+        }
+    }
+    ScopedFd(const ScopedFd&) = delete;
+    ScopedFd& operator=(const ScopedFd&) = delete;
+
+    int m_fd;
+};
+
+std::string UBootEnv::getValue(const std::string& i_name)
+{
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    load();
+
+    const auto l_itrToVariable = std::ranges::find(
+        m_variables, i_name,
+        &std::pair<std::string, std::string>::first);
+
+    return (l_itrToVariable != m_variables.end())
+               ? l_itrToVariable->second
+               : std::string{};
+}
+
+void UBootEnv::setValue(const std::string& i_name, const std::string& i_value)
+{
+    if (i_name.empty() || i_name.find('=') != std::string::npos)
+    {
+        throw std::runtime_error(
+            "Invalid U-Boot environment variable name [" + i_name + "]");
+    }
+
+    std::lock_guard<std::mutex> l_lock(m_mutex);
+    load();
+
+    auto l_variables = m_variables;
+    const auto l_itrToVariable = std::ranges::find(
+        l_variables, i_name, &std::pair<std::string, std::string>::first);
+
+    if (l_itrToVariable != l_variables.end())
+    {
+        if (l_itrToVariable->second == i_value)
+        {
+            return;
+        }
+
+        if (i_value.empty())
+        {
+            l_variables.erase(l_itrToVariable);
+        }
+        else
+        {
+            l_itrToVariable->second = i_value;
+        }
+    }
+    else if (!i_value.empty())
+    {
+        l_variables.emplace_back(i_name, i_value);
+    }
+    else
+    {
+        return;
+    }
+
+    const bool l_isRedundant = (m_copies.size() > 1);
+    const size_t l_targetCopy = l_isRedundant ? (1 - m_activeCopy) : 0;
+    const Copy& l_copy = m_copies[l_targetCopy];
+    const size_t l_headerSize = crcSize + (l_isRedundant ? 1 : 0);
+
+    // Data area holds "name=value" strings, terminated by an empty string.
+    types::BinaryVector l_data;
+    l_data.reserve(l_copy.m_size - l_headerSize);
+    for (const auto& [l_name, l_value] : l_variables)
+    {
+        l_data.insert(l_data.end(), l_name.begin(), l_name.end());
+        l_data.push_back('=');
+        l_data.insert(l_data.end(), l_value.begin(), l_value.end());
+        l_data.push_back('\0');
+    }
+    l_data.push_back('\0');
+
+    if (l_data.size() > l_copy.m_size - l_headerSize)
+    {
+        throw std::runtime_error("U-Boot environment is full.");
+    }
+    l_data.resize(l_copy.m_size - l_headerSize, 0);
+
+    const uint32_t l_crc = computeCrc(l_data);
+    const bool l_isMtd = isMtdDevice(l_copy.m_device);
+    const uint8_t l_flags =
+        l_isMtd ? activeFlag : static_cast<uint8_t>(m_flags + 1);
+
+    types::BinaryVector l_image;
+    l_image.reserve(l_copy.m_size);
+    for (size_t l_byte = 0; l_byte < crcSize; ++l_byte)
+    {
+        l_image.push_back(static_cast<uint8_t>(l_crc >> (8 * l_byte)));
+    }
+    if (l_isRedundant)
+    {
+        l_image.push_back(l_flags);
+    }
+    l_image.insert(l_image.end(), l_data.begin(), l_data.end());
+
+    writeCopy(l_copy, l_image);
+
+    if (l_isRedundant && l_isMtd)
+    {
+        // New copy is complete, retire the old one. Clearing bits of a flag
+        // doesn't need an erase.
+        const Copy& l_oldCopy = m_copies[m_activeCopy];
+        ScopedFd l_fd(open(l_oldCopy.m_device.c_str(), O_WRONLY | O_CLOEXEC));
+
+        if (l_fd.m_fd < 0 ||
+            pwrite(l_fd.m_fd, &obsoleteFlag, sizeof(obsoleteFlag),
+                   l_oldCopy.m_offset + crcSize) != sizeof(obsoleteFlag))
+        {
+            logging::logMessage(
+                "Failed to mark old U-Boot environment obsolete, error: " +
+                std::string(std::strerror(errno)));
+        }
+    }
+
+    m_variables = std::move(l_variables);
+    m_activeCopy = l_targetCopy;
+    m_flags = l_flags;
+}
+
+void UBootEnv::load()
+{
+    if (m_isLoaded)
+    {
+        return;
+    }
+
+    std::vector<Copy> l_copies = readConfig();
+    const bool l_isRedundant = (l_copies.size() > 1);
+
+    std::array<std::optional<std::pair<uint8_t, types::BinaryVector>>, 2>
+        l_contents;
+    for (size_t l_index = 0; l_index < l_copies.size(); ++l_index)
+    {
+        l_contents[l_index] = readCopy(l_copies[l_index], l_isRedundant);
+    }
+
+    size_t l_activeCopy = 0;
+    if (l_contents[0] && l_contents[1])
+    {
+        l_activeCopy =
+            selectActiveCopy(l_contents[0]->first, l_contents[1]->first);
+    }
+    else if (l_contents[1])
+    {
+        l_activeCopy = 1;
+    }
+    else if (!l_contents[0])
+    {
+        // Same as fw_printenv, carry on with an empty environment, so that
+        // variables read as not set and the next write creates a valid copy.
+        // Make copy 0 the target of that write.
+        logging::logMessage(
+            "No valid copy of U-Boot environment found, using empty "
+            "environment.");
+
+        l_activeCopy = l_isRedundant ? 1 : 0;
+        l_contents[l_activeCopy].emplace(0, types::BinaryVector{});
+    }
+
+    const auto& [l_flags, l_data] = *l_contents[l_activeCopy];
+
+    if (!l_isRedundant)
+    {
+        logging::logMessage<logging::LogLevel::Warning>(
+            "U-Boot environment has a single copy, a power loss while writing "
+            "it leaves no valid environment.");
+    }
+
+    m_copies = std::move(l_copies);
+    m_activeCopy = l_activeCopy;
+    m_flags = l_flags;
+    m_variables = parseVariables(l_data);
+    m_isLoaded = true;
+}
+
+std::vector<std::pair<std::string, std::string>> UBootEnv::parseVariables(
+    const types::BinaryVector& i_data)
+{
+    std::vector<std::pair<std::string, std::string>> l_variables;
+    auto l_itrToEntry = i_data.begin();
+    while (l_itrToEntry != i_data.end() && *l_itrToEntry != '\0')
+    {
+        const auto l_itrToEnd = std::find(l_itrToEntry, i_data.end(), '\0');
+        const std::string l_entry(l_itrToEntry, l_itrToEnd);
+
+        const size_t l_separatorPos = l_entry.find('=');
+        if (l_separatorPos != std::string::npos)
+        {
+            l_variables.emplace_back(l_entry.substr(0, l_separatorPos),
+                                     l_entry.substr(l_separatorPos + 1));
+        }
+
+        l_itrToEntry =
+            (l_itrToEnd == i_data.end()) ? l_itrToEnd : l_itrToEnd + 1;
+    }
+    return l_variables;
+}
+
+size_t UBootEnv::selectActiveCopy(uint8_t i_flags0, uint8_t i_flags1) noexcept
+{
+    // Incremental flags may have wrapped around.
+    if (i_flags0 == 0xFF && i_flags1 == 0)
+    {
+        return 1;
+    }
+
+    if (i_flags1 == 0xFF && i_flags0 == 0)
+    {
+        return 0;
+    }
+
+    return (i_flags1 > i_flags0) ? 1 : 0;
+}
+
+std::vector<UBootEnv::Copy> UBootEnv::readConfig()
+{
+    std::ifstream l_configFile(constants::ubootEnvConfigPath);
+    if (!l_configFile)
+    {
+        throw std::runtime_error(std::string("Failed to open ") +
+                                 constants::ubootEnvConfigPath);
+    }
+
+    std::vector<Copy> l_copies;
+    std::string l_line;
+    while (std::getline(l_configFile, l_line) && l_copies.size() < 2)
+    {
+        l_line = l_line.substr(0, l_line.find('#'));
+
+        std::istringstream l_fields(l_line);
+        std::string l_device, l_offset, l_size, l_sectorSize;
+        if (!(l_fields >> l_device >> l_offset >> l_size))
+        {
+            continue;
+        }
+        l_fields >> l_sectorSize;
+
+        Copy l_copy;
+        l_copy.m_device = l_device;
+        l_copy.m_offset = static_cast<off_t>(std::stoll(l_offset, nullptr, 0));
+        l_copy.m_size = std::stoul(l_size, nullptr, 0);
+        l_copy.m_sectorSize =
+            l_sectorSize.empty() ? 0 : std::stoul(l_sectorSize, nullptr, 0);
+
+        if (l_copy.m_size <= crcSize + 1)
+        {
+            throw std::runtime_error(
+                "Invalid U-Boot environment size in config.");
+        }
+        l_copies.push_back(std::move(l_copy));
+    }
+
+    if (l_copies.empty())
+    {
+        throw std::runtime_error(
+            "No U-Boot environment location found in config.");
+    }
+    return l_copies;
+}
+
+std::optional<std::pair<uint8_t, types::BinaryVector>> UBootEnv::readCopy(
+    const Copy& i_copy, bool i_isRedundant) noexcept
+{
+    try
+    {
+        ScopedFd l_fd(open(i_copy.m_device.c_str(), O_RDONLY | O_CLOEXEC));
+        if (l_fd.m_fd < 0)
+        {
+            throw std::runtime_error(std::strerror(errno));
+        }
+
+        types::BinaryVector l_image(i_copy.m_size);
+        if (pread(l_fd.m_fd, l_image.data(), l_image.size(),
+                  i_copy.m_offset) != static_cast<ssize_t>(l_image.size()))
+        {
+            throw std::runtime_error("Short read");
+        }
+
+        uint32_t l_storedCrc = 0;
+        for (size_t l_byte = 0; l_byte < crcSize; ++l_byte)
+        {
+            l_storedCrc |= static_cast<uint32_t>(l_image[l_byte])
+                           << (8 * l_byte);
+        }
+
+        const size_t l_headerSize = crcSize + (i_isRedundant ? 1 : 0);
+        const uint8_t l_flags = i_isRedundant ? l_image[crcSize] : 0;
+        types::BinaryVector l_data(l_image.begin() + l_headerSize,
+                                   l_image.end());
+
+        if (computeCrc(l_data) != l_storedCrc)
+        {
+            logging::logMessage("Bad CRC for U-Boot environment on " +
+                                i_copy.m_device);
+            return std::nullopt;
+        }
+
+        return std::make_pair(l_flags, std::move(l_data));
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to read U-Boot environment from " +
+                            i_copy.m_device + ", error: " + l_ex.what());
+    }
+    return std::nullopt;
+}
+
+void UBootEnv::writeCopy(const Copy& i_copy,
+                         const types::BinaryVector& i_image)
+{
+    ScopedFd l_fd(open(i_copy.m_device.c_str(), O_RDWR | O_SYNC | O_CLOEXEC));
+    if (l_fd.m_fd < 0)
+    {
+        throw std::runtime_error("Failed to open " + i_copy.m_device +
+                                 ", error: " + std::strerror(errno));
+    }
+
+    off_t l_writeOffset = i_copy.m_offset;
+    types::BinaryVector l_buffer = i_image;
+
+    if (isMtdDevice(i_copy.m_device))
+    {
+        mtd_info_user l_mtdInfo{};
+        if (ioctl(l_fd.m_fd, MEMGETINFO, &l_mtdInfo) < 0)
+        {
+            throw std::runtime_error("Failed to get MTD info of " +
+                                     i_copy.m_device + ", error: " +
+                                     std::strerror(errno));
+        }
+
+        const off_t l_eraseSize = static_cast<off_t>(
+            i_copy.m_sectorSize ? i_copy.m_sectorSize : l_mtdInfo.erasesize);
+
+        // Flash is erased in whole blocks, keep the rest of the blocks as is.
+        const off_t l_blockStart =
+            (i_copy.m_offset / l_eraseSize) * l_eraseSize;
+        const off_t l_blockEnd =
+            ((i_copy.m_offset + static_cast<off_t>(i_image.size()) +
+              l_eraseSize - 1) /
+             l_eraseSize) *
+            l_eraseSize;
+
+        l_buffer.resize(l_blockEnd - l_blockStart);
+        if (pread(l_fd.m_fd, l_buffer.data(), l_buffer.size(), l_blockStart) !=
+            static_cast<ssize_t>(l_buffer.size()))
+        {
+            throw std::runtime_error("Failed to read " + i_copy.m_device);
+        }
+        std::ranges::copy(i_image,
+                          l_buffer.begin() + (i_copy.m_offset - l_blockStart));
+
+        erase_info_user l_eraseInfo{};
+        l_eraseInfo.start = static_cast<uint32_t>(l_blockStart);
+        l_eraseInfo.length = static_cast<uint32_t>(l_blockEnd - l_blockStart);
+        if (ioctl(l_fd.m_fd, MEMERASE, &l_eraseInfo) < 0)
+        {
+            throw std::runtime_error("Failed to erase " + i_copy.m_device +
+                                     ", error: " + std::strerror(errno));
+        }
+        l_writeOffset = l_blockStart;
+    }
+
+    if (pwrite(l_fd.m_fd, l_buffer.data(), l_buffer.size(), l_writeOffset) !=
+        static_cast<ssize_t>(l_buffer.size()))
+    {
+        throw std::runtime_error("Failed to write " + i_copy.m_device +
+                                 ", error: " + std::strerror(errno));
+    }
+
+    if (fsync(l_fd.m_fd) != 0 && errno != EINVAL)
+    {
+        throw std::runtime_error("Failed to sync " + i_copy.m_device +
+                                 ", error: " + std::strerror(errno));
+    }
+}
+
+uint32_t UBootEnv::computeCrc(const types::BinaryVector& i_data) noexcept
+{
+    static constexpr auto l_table = [] {
+        std::array<uint32_t, 256> l_entries{};
+        for (uint32_t l_index = 0; l_index < l_entries.size(); ++l_index)
+        {
+            uint32_t l_value = l_index;
+            for (int l_bit = 0; l_bit < 8; ++l_bit)
+            {
+                l_value = (l_value & 1) ? (0xEDB88320 ^ (l_value >> 1))
+                                        : (l_value >> 1);
+            }
+            l_entries[l_index] = l_value;
+        }
+        return l_entries;
+    }();
+
+    uint32_t l_crc = 0xFFFFFFFF;
+    for (const uint8_t l_byte : i_data)
+    {
+        l_crc = l_table[(l_crc ^ l_byte) & 0xFF] ^ (l_crc >> 8);
+    }
+    return l_crc ^ 0xFFFFFFFF;
+}
+} // namespace vpd
@@ -65,7 +65,9 @@ int main(int argc, char** argv)
                 "Processing with config file - " + configFilePath);
 
             std::shared_ptr<vpd::Worker> objWorker =
-                std::make_shared<vpd::Worker>(configFilePath);
+                std::make_shared<vpd::Worker>(
+                    configFilePath, std::make_shared<vpd::UBootEnv>(),
+                    std::make_shared<vpd::SystemStateCache>());
             parsedVpdDataMap = objWorker->parseVpdFile(vpdFilePath);
 
             // Based on requirement, call appropriate public API of worker class
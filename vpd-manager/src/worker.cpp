@@ -5,19 +5,24 @@
 #include "backup_restore.hpp"
 #include "configuration.hpp"
 #include "constants.hpp"
+#include "eeprom_write_queue.hpp"
 #include "event_logger.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
 #include "parser.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
+#include "system_state_cache.hpp"
+#include "uboot_env.hpp"
 
 #include <utility/dbus_utility.hpp>
 #include <utility/json_utility.hpp>
 #include <utility/vpd_specific_utility.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <future>
 #include <typeindex>
 #include <unordered_set>
@@ -25,8 +30,12 @@
 namespace vpd
 {
 
-Worker::Worker(std::string pathToConfigJson, uint8_t i_maxThreadCount) :
-    m_configJsonPath(pathToConfigJson), m_semaphore(i_maxThreadCount)
+Worker::Worker(std::string pathToConfigJson,
+               const std::shared_ptr<UBootEnv>& i_uBootEnv,
+               const std::shared_ptr<SystemStateCache>& i_systemStateCache,
+               uint8_t i_maxThreadCount) :
+    m_configJsonPath(pathToConfigJson), m_semaphore(i_maxThreadCount),
+    m_uBootEnv(i_uBootEnv), m_systemStateCache(i_systemStateCache)
 {
     // Implies the processing is based on some config JSON
     if (!m_configJsonPath.empty())
@@ -42,10 +51,11 @@ Worker::Worker(std::string pathToConfigJson, uint8_t i_maxThreadCount) :
 
         try
         {
-            m_parsedJson = jsonUtility::getParsedJson(m_configJsonPath);
+            m_parsedJson = std::make_shared<const nlohmann::json>(
+                jsonUtility::getParsedJson(m_configJsonPath));
 
             // check for mandatory fields at this point itself.
-            if (!m_parsedJson.contains("frus"))
+            if (!m_parsedJson->contains("frus"))
             {
                 throw std::runtime_error("Mandatory tag(s) missing from JSON");
             }
@@ -59,36 +69,61 @@ Worker::Worker(std::string pathToConfigJson, uint8_t i_maxThreadCount) :
     {
         logging::logMessage("Processing in not based on any config JSON");
     }
+
+    // Keep caches in sync with keyword writes, whoever makes them.
+    m_eepromWriteQueue->setWriteListener(
+        [this](const std::string& i_eepromPath,
+               const types::WriteVpdParams& i_paramsToWriteData) {
+            processKeywordWrite(i_eepromPath, i_paramsToWriteData);
+        });
 }
 
-static std::string readFitConfigValue()
+Worker::~Worker()
 {
-    std::vector<std::string> output =
-        commonUtility::executeCmd("/sbin/fw_printenv");
-    std::string fitConfigValue;
+    // Queue may outlive the worker with writers still holding it.
+    m_eepromWriteQueue->setWriteListener(nullptr);
+}
 
-    for (const auto& entry : output)
+void Worker::processKeywordWrite(
+    const std::string& i_eepromPath,
+    const types::WriteVpdParams& i_paramsToWriteData)
+{
+    // Primary and redundant EEPROMs are both written through the queue.
+    invalidateParsedVpd(i_eepromPath);
+
+    if (i_eepromPath != SYSTEM_VPD_FILE_PATH)
     {
-        auto pos = entry.find("=");
-        auto key = entry.substr(0, pos);
-        if (key != "fitconfig")
-        {
-            continue;
-        }
+        return;
+    }
 
-        if (pos + 1 < entry.size())
-        {
-            fitConfigValue = entry.substr(pos + 1);
-        }
+    if (const auto l_ipzData =
+            std::get_if<types::IpzData>(&i_paramsToWriteData))
+    {
+        updateCachedSystemKeyword(std::get<0>(*l_ipzData),
+                                  std::get<1>(*l_ipzData),
+                                  std::get<2>(*l_ipzData));
     }
+}
 
-    return fitConfigValue;
+// Set on threads collecting FRUs in bulk. Presence sampled in the collection
+// context is meant only for them, it is stale for anyone else. Only they can
+// block waiting for an EEPROM to appear.
+static thread_local bool s_isBulkCollectionThread = false;
+
+// Value is cached by UBootEnv for lifetime of the object, a change made with
+// fw_setenv by another process is not seen till vpd-manager restarts.
+static std::string readFitConfigValue(UBootEnv& io_uBootEnv)
+{
+    return io_uBootEnv.getValue("fitconfig");
 }
 
 bool Worker::isSystemVPDOnDBus() const
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     const std::string& mboardPath =
-        m_parsedJson["frus"][SYSTEM_VPD_FILE_PATH].at(0).value(
+        l_sysCfgJsonObj->at("frus").at(SYSTEM_VPD_FILE_PATH).at(0).value(
             "inventoryPath", "");
 
     if (mboardPath.empty())
@@ -184,6 +219,9 @@ std::string Worker::getHWVersion(const types::IPZVpdMap& parsedVpd) const
 void Worker::fillVPDMap(const std::string& vpdFilePath,
                         types::VPDMapVariant& vpdMap)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     logging::logMessage(std::string("Parsing file = ") + vpdFilePath);
 
     if (vpdFilePath.empty())
@@ -197,7 +235,7 @@ void Worker::fillVPDMap(const std::string& vpdFilePath,
     }
 
     std::shared_ptr<Parser> vpdParser =
-        std::make_shared<Parser>(vpdFilePath, m_parsedJson);
+        std::make_shared<Parser>(vpdFilePath, l_sysCfgJsonObj);
     vpdMap = vpdParser->parse();
 }
 
@@ -258,10 +296,11 @@ void Worker::getSystemJson(std::string& systemJson,
         "Invalid VPD type returned from Parser. Can't get system JSON.");
 }
 
-static void setEnvAndReboot(const std::string& key, const std::string& value)
+static void setEnvAndReboot(UBootEnv& io_uBootEnv, const std::string& key,
+                            const std::string& value)
 {
     // set env and reboot and break.
-    commonUtility::executeCmd("/sbin/fw_setenv", key, value);
+    io_uBootEnv.setValue(key, value);
     logging::logMessage("Rebooting BMC to pick up new device tree");
 
     // make dbus call to reboot
@@ -349,14 +388,47 @@ void Worker::setJsonSymbolicLink(const std::string& i_systemJson)
     m_isFactoryResetDone = true;
 }
 
+bool Worker::isLinkedJsonSelected(const std::string& i_systemJson) const
+{
+    if (!m_isSymlinkPresent)
+    {
+        return false;
+    }
+
+    std::error_code l_ec;
+    const std::filesystem::path l_linkedJsonPath =
+        std::filesystem::read_symlink(INVENTORY_JSON_SYM_LINK, l_ec);
+
+    if (l_ec)
+    {
+        logging::logMessage("Can't read existing symlink. Error = " +
+                            l_ec.message());
+        return false;
+    }
+
+    if (l_linkedJsonPath != i_systemJson)
+    {
+        logging::logMessage("Linked JSON " + l_linkedJsonPath.string() +
+                            " doesn't match system JSON " + i_systemJson);
+        return false;
+    }
+    return true;
+}
+
 void Worker::setDeviceTreeAndJson()
 {
     // JSON is madatory for processing of this API.
-    if (m_parsedJson.empty())
+    if (getSysCfgJsonObj()->empty())
     {
         throw JsonException("System config JSON is empty", m_configJsonPath);
     }
 
+    // Device tree in use is needed only at the end, read it while system VPD
+    // is being parsed.
+    std::future<std::string> l_fitConfigFuture =
+        std::async(std::launch::async, readFitConfigValue,
+                   std::ref(*m_uBootEnv));
+
     types::VPDMapVariant parsedVpdMap;
     fillVPDMap(SYSTEM_VPD_FILE_PATH, parsedVpdMap);
 
@@ -375,18 +447,36 @@ void Worker::setDeviceTreeAndJson()
             "No system JSON found corresponding to IM read from VPD.");
     }
 
-    // re-parse the JSON once appropriate JSON has been selected.
-    m_parsedJson = jsonUtility::getParsedJson(systemJson);
-
-    if (m_parsedJson.empty())
+    std::shared_ptr<const nlohmann::json> l_systemJsonObj;
+    if (isLinkedJsonSelected(systemJson))
     {
-        throw(JsonException("Json parsing failed", systemJson));
+        // JSON loaded through the symlink at construction is the one selected
+        // by system VPD, no need to parse it again.
+        l_systemJsonObj = getSysCfgJsonObj();
+    }
+    else
+    {
+        // re-parse the JSON once appropriate JSON has been selected.
+        l_systemJsonObj = std::make_shared<const nlohmann::json>(
+            jsonUtility::getParsedJson(systemJson));
+
+        if (l_systemJsonObj->empty())
+        {
+            throw(JsonException("Json parsing failed", systemJson));
+        }
+
+        {
+            // Publish the new snapshot. Readers holding the previous one keep
+            // it alive until they are done with it.
+            std::lock_guard<std::mutex> l_lock(m_sysCfgJsonMutex);
+            m_parsedJson = l_systemJsonObj;
+        }
     }
 
     std::string devTreeFromJson;
-    if (m_parsedJson.contains("devTree"))
+    if (l_systemJsonObj->contains("devTree"))
     {
-        devTreeFromJson = m_parsedJson["devTree"];
+        devTreeFromJson = l_systemJsonObj->at("devTree");
 
         if (devTreeFromJson.empty())
         {
@@ -399,7 +489,7 @@ void Worker::setDeviceTreeAndJson()
         }
     }
 
-    auto fitConfigVal = readFitConfigValue();
+    auto fitConfigVal = l_fitConfigFuture.get();
 
     if (devTreeFromJson.empty() ||
         fitConfigVal.find(devTreeFromJson) != std::string::npos)
@@ -409,7 +499,7 @@ void Worker::setDeviceTreeAndJson()
         setJsonSymbolicLink(systemJson);
 
         if (isSystemVPDOnDBus() &&
-            jsonUtility::isBackupAndRestoreRequired(m_parsedJson))
+            jsonUtility::isBackupAndRestoreRequired(*l_systemJsonObj))
         {
             performBackupAndRestore(parsedVpdMap);
         }
@@ -419,10 +509,89 @@ void Worker::setDeviceTreeAndJson()
         return;
     }
 
-    setEnvAndReboot("fitconfig", devTreeFromJson);
+    setEnvAndReboot(*m_uBootEnv, "fitconfig", devTreeFromJson);
     exit(EXIT_SUCCESS);
 }
 
+void Worker::cacheSystemKeywords(const types::IPZVpdMap& i_ipzVpdMap)
+{
+    types::IPZVpdMap l_systemKeywords;
+
+    for (const auto& [l_recordName, l_keywords] :
+         {std::make_pair(constants::recVCEN,
+                         std::array{constants::kwdFC, constants::kwdSE}),
+          std::make_pair(constants::recVSYS,
+                         std::array{constants::kwdTM, constants::kwdSE})})
+    {
+        const auto l_itrToRecord = i_ipzVpdMap.find(l_recordName);
+        if (l_itrToRecord == i_ipzVpdMap.end())
+        {
+            continue;
+        }
+
+        for (const auto& l_keyword : l_keywords)
+        {
+            const auto l_itrToKwd = l_itrToRecord->second.find(l_keyword);
+            if (l_itrToKwd != l_itrToRecord->second.end())
+            {
+                l_systemKeywords[l_recordName].emplace(l_keyword,
+                                                       l_itrToKwd->second);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> l_lock(m_systemKeywordCacheMutex);
+    m_systemKeywordCache = std::move(l_systemKeywords);
+}
+
+void Worker::updateCachedSystemKeyword(const std::string& i_recordName,
+                                       const std::string& i_keywordName,
+                                       const types::BinaryVector& i_value)
+{
+    std::lock_guard<std::mutex> l_lock(m_systemKeywordCacheMutex);
+
+    auto l_itrToRecord = m_systemKeywordCache.find(i_recordName);
+    if (l_itrToRecord == m_systemKeywordCache.end())
+    {
+        return;
+    }
+
+    auto l_itrToKwd = l_itrToRecord->second.find(i_keywordName);
+    if (l_itrToKwd != l_itrToRecord->second.end())
+    {
+        l_itrToKwd->second.assign(i_value.begin(), i_value.end());
+    }
+}
+
+types::IPZVpdMap Worker::getCachedSystemKeywords() const
+{
+    std::lock_guard<std::mutex> l_lock(m_systemKeywordCacheMutex);
+    return m_systemKeywordCache;
+}
+
+std::optional<types::VPDMapVariant>
+    Worker::getCachedParsedVpd(const std::string& i_vpdFilePath) const
+{
+    return m_parsedVpdCache.get(i_vpdFilePath);
+}
+
+uint64_t Worker::getParsedVpdGeneration(const std::string& i_vpdFilePath) const
+{
+    return m_parsedVpdCache.getGeneration(i_vpdFilePath);
+}
+
+void Worker::cacheParsedVpd(const std::string& i_vpdFilePath,
+                            const types::VPDMapVariant& i_parsedVpd,
+                            uint64_t i_generation)
+{
+    m_parsedVpdCache.put(i_vpdFilePath, i_parsedVpd, i_generation);
+}
+
+void Worker::invalidateParsedVpd(const std::string& i_vpdFilePath)
+{
+    m_parsedVpdCache.invalidate(i_vpdFilePath);
+}
+
 void Worker::populateIPZVPDpropertyMap(
     types::InterfaceMap& interfacePropMap,
     const types::IPZKwdValueMap& keyordValueMap,
@@ -539,7 +708,7 @@ void Worker::populateInterfaces(const nlohmann::json& interfaceJson,
                     std::string value =
                         vpdSpecificUtility::getExpandedLocationCode(
                             propValuePair.value().get<std::string>(),
-                            parsedVpdMap);
+                            parsedVpdMap, getCachedSystemKeywords());
                     propertyMap.emplace(property, value);
 
                     auto l_locCodeProperty = propertyMap;
@@ -663,26 +832,82 @@ bool Worker::isCPUIOGoodOnly(const std::string& i_pgKeyword)
 
 bool Worker::primeInventory(const std::string& i_vpdFilePath)
 {
+    types::ObjectMap l_objectInterfaceMap;
+    if (!populatePrimeObjectMap(i_vpdFilePath, std::nullopt,
+                                l_objectInterfaceMap))
+    {
+        return false;
+    }
+
+    // Notify PIM
+    if (!dbusUtility::callPIM(move(l_objectInterfaceMap)))
+    {
+        logging::logMessage("Call to PIM failed for VPD file " + i_vpdFilePath);
+        return false;
+    }
+
+    return true;
+}
+
+bool Worker::primeInventory(const std::vector<std::string>& i_vpdFilePaths)
+{
+    // Fetch data of all the objects under PIM once, instead of querying it
+    // for each FRU.
+    const std::optional<types::ObjectMap> l_pimObjects =
+        dbusUtility::getManagedObjects(constants::pimServiceName,
+                                       constants::pimPath);
+
+    bool l_rc = true;
+    types::ObjectMap l_objectInterfaceMap;
+
+    for (const auto& l_vpdFilePath : i_vpdFilePaths)
+    {
+        if (!populatePrimeObjectMap(l_vpdFilePath, l_pimObjects,
+                                    l_objectInterfaceMap))
+        {
+            logging::logMessage(
+                "Priming of inventory failed for FRU " + l_vpdFilePath);
+            l_rc = false;
+        }
+    }
+
+    // Notify PIM
+    if (!dbusUtility::callPIM(move(l_objectInterfaceMap)))
+    {
+        logging::logMessage("Call to PIM failed while priming inventory");
+        return false;
+    }
+
+    return l_rc;
+}
+
+bool Worker::populatePrimeObjectMap(
+    const std::string& i_vpdFilePath,
+    const std::optional<types::ObjectMap>& i_pimObjects,
+    types::ObjectMap& io_objectInterfaceMap)
+{
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (i_vpdFilePath.empty())
     {
         logging::logMessage("Empty VPD file path given");
         return false;
     }
 
-    if (m_parsedJson.empty())
+    if (l_sysCfgJsonObj->empty())
     {
         logging::logMessage("Empty JSON detected for " + i_vpdFilePath);
         return false;
     }
-    else if (!m_parsedJson["frus"].contains(i_vpdFilePath))
+    else if (!l_sysCfgJsonObj->at("frus").contains(i_vpdFilePath))
     {
         logging::logMessage("File " + i_vpdFilePath +
                             ", is not found in the system config JSON file.");
         return false;
     }
 
-    types::ObjectMap l_objectInterfaceMap;
-    for (const auto& l_Fru : m_parsedJson["frus"][i_vpdFilePath])
+    for (const auto& l_Fru : l_sysCfgJsonObj->at("frus").at(i_vpdFilePath))
     {
         types::InterfaceMap l_interfaces;
         sdbusplus::message::object_path l_fruObjectPath(l_Fru["inventoryPath"]);
@@ -702,8 +927,20 @@ bool Worker::primeInventory(const std::string& i_vpdFilePath)
         if (isPresentPropertyHandlingRequired(l_Fru))
         {
             // Clear data under PIM if already exists.
-            vpdSpecificUtility::resetDataUnderPIM(
-                std::string(l_Fru["inventoryPath"]), l_interfaces);
+            if (i_pimObjects.has_value())
+            {
+                const auto l_itrToObject = i_pimObjects->find(l_fruObjectPath);
+                if (l_itrToObject != i_pimObjects->end())
+                {
+                    vpdSpecificUtility::resetDataUnderPIM(
+                        l_itrToObject->second, l_interfaces);
+                }
+            }
+            else
+            {
+                vpdSpecificUtility::resetDataUnderPIM(
+                    std::string(l_Fru["inventoryPath"]), l_interfaces);
+            }
         }
 
         // Add extra interfaces mentioned in the Json config file
@@ -736,10 +973,10 @@ bool Worker::primeInventory(const std::string& i_vpdFilePath)
                                           move(l_propertyValueMap));
 
         if (l_Fru.value("inherit", true) &&
-            m_parsedJson.contains("commonInterfaces"))
+            l_sysCfgJsonObj->contains("commonInterfaces"))
         {
-            populateInterfaces(m_parsedJson["commonInterfaces"], l_interfaces,
-                               std::monostate{});
+            populateInterfaces(l_sysCfgJsonObj->at("commonInterfaces"),
+                               l_interfaces, std::monostate{});
         }
 
         processFunctionalProperty(l_Fru["inventoryPath"], l_interfaces);
@@ -753,15 +990,8 @@ bool Worker::primeInventory(const std::string& i_vpdFilePath)
                                           constants::vpdCollectionInterface,
                                           std::move(l_fruCollectionProperty));
 
-        l_objectInterfaceMap.emplace(std::move(l_fruObjectPath),
-                                     std::move(l_interfaces));
-    }
-
-    // Notify PIM
-    if (!dbusUtility::callPIM(move(l_objectInterfaceMap)))
-    {
-        logging::logMessage("Call to PIM failed for VPD file " + i_vpdFilePath);
-        return false;
+        io_objectInterfaceMap.emplace(std::move(l_fruObjectPath),
+                                      std::move(l_interfaces));
     }
 
     return true;
@@ -850,6 +1080,9 @@ void Worker::processCopyRecordFlag(const nlohmann::json& singleFru,
 void Worker::processInheritFlag(const types::VPDMapVariant& parsedVpdMap,
                                 types::InterfaceMap& interfaces)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (auto ipzVpdMap = std::get_if<types::IPZVpdMap>(&parsedVpdMap))
     {
         for (const auto& [recordName, kwdValueMap] : *ipzVpdMap)
@@ -863,9 +1096,9 @@ void Worker::processInheritFlag(const types::VPDMapVariant& parsedVpdMap,
         populateKwdVPDpropertyMap(*kwdVpdMap, interfaces);
     }
 
-    if (m_parsedJson.contains("commonInterfaces"))
+    if (l_sysCfgJsonObj->contains("commonInterfaces"))
     {
-        populateInterfaces(m_parsedJson["commonInterfaces"], interfaces,
+        populateInterfaces(l_sysCfgJsonObj->at("commonInterfaces"), interfaces,
                            parsedVpdMap);
     }
 }
@@ -913,31 +1146,170 @@ bool Worker::processFruWithCCIN(const nlohmann::json& singleFru,
     return true;
 }
 
-void Worker::processFunctionalProperty(const std::string& i_inventoryObjPath,
-                                       types::InterfaceMap& io_interfaces)
+void Worker::createCollectionContext()
 {
-    if (!dbusUtility::isChassisPowerOn())
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
+    auto l_context = std::make_shared<CollectionContext>();
+    l_context->m_isChassisPowerOn = m_systemStateCache->isChassisPowerOn();
+
+    const types::MapperGetSubTree& l_subTree = dbusUtility::getObjectSubTree(
+        constants::pimPath, 0,
+        {constants::operationalStatusInf, constants::enableInf});
+
+    for (const auto& [l_objectPath, l_serviceInfMap] : l_subTree)
     {
-        std::array<const char*, 1> l_operationalStatusInf = {
-            constants::operationalStatusInf};
+        const auto l_itrToPim = l_serviceInfMap.find(constants::pimServiceName);
+        if (l_itrToPim != l_serviceInfMap.end())
+        {
+            l_context->m_pimInterfaces.emplace(l_objectPath,
+                                               l_itrToPim->second);
+        }
+    }
 
-        auto mapperObjectMap = dbusUtility::getObjectMap(
-            i_inventoryObjPath, l_operationalStatusInf);
+    if (l_sysCfgJsonObj->contains("frus"))
+    {
+        static const nlohmann::json::json_pointer l_presencePinPointer(
+            "/0/preAction/collection/gpioPresence/pin");
 
-        // If the object has been found. Check if it is under PIM.
-        if (mapperObjectMap.size() != 0)
+        std::vector<std::string> l_presencePins;
+        for (const auto& l_fru : l_sysCfgJsonObj->at("frus").items())
         {
-            for (const auto& [l_serviceName, l_interfaceLsit] : mapperObjectMap)
+            if (l_fru.value().contains(l_presencePinPointer) &&
+                l_fru.value().at(l_presencePinPointer).is_string())
             {
-                if (l_serviceName == constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
+                l_presencePins.push_back(
+                    l_fru.value().at(l_presencePinPointer).get<std::string>());
             }
         }
 
+        // Pins are read in bulk per chip, so the presence check in pre-action
+        // of each FRU collected in this pass is a lookup.
+        l_context->m_presencePinValues =
+            m_gpioService.getValues(l_presencePins, "Read the presence line");
+    }
+
+    std::lock_guard<std::mutex> l_lock(m_collectionContextMutex);
+    m_collectionContext = std::move(l_context);
+}
+
+void Worker::clearCollectionContext()
+{
+    std::lock_guard<std::mutex> l_lock(m_collectionContextMutex);
+    m_collectionContext.reset();
+}
+
+std::shared_ptr<const Worker::CollectionContext>
+    Worker::getCollectionContext() const
+{
+    std::lock_guard<std::mutex> l_lock(m_collectionContextMutex);
+    return m_collectionContext;
+}
+
+bool Worker::isChassisPowerOn() const
+{
+    if (const auto l_context = getCollectionContext(); l_context)
+    {
+        return l_context->m_isChassisPowerOn;
+    }
+    return m_systemStateCache->isChassisPowerOn();
+}
+
+bool Worker::isFruAbsentInCollectionContext(
+    const std::string& i_vpdFilePath) const noexcept
+{
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
+    try
+    {
+        if (!s_isBulkCollectionThread)
+        {
+            return false;
+        }
+
+        const auto l_context = getCollectionContext();
+        if (!l_context)
+        {
+            return false;
+        }
+
+        const nlohmann::json& l_presenceJson =
+            l_sysCfgJsonObj->at("frus").at(i_vpdFilePath).at(0).value(
+                nlohmann::json::json_pointer(
+                    "/preAction/collection/gpioPresence"),
+                nlohmann::json::object());
+
+        if (!l_presenceJson.contains("pin") ||
+            !l_presenceJson.contains("value"))
+        {
+            return false;
+        }
+
+        const std::string l_pinName = l_presenceJson["pin"];
+        const int l_presenceValue = l_presenceJson["value"];
+
+        const auto l_itrToPin = l_context->m_presencePinValues.find(l_pinName);
+        if (l_itrToPin == l_context->m_presencePinValues.end() ||
+            l_itrToPin->second == l_presenceValue)
+        {
+            return false;
+        }
+
+        // Sample is taken before pre-actions of other FRUs, like enabling a
+        // mux or setting a GPIO, which the presence line may depend on. Hence
+        // absence is confirmed by reading the line again.
+        return (m_gpioService.getValue(l_pinName, "Read the presence line") !=
+                l_presenceValue);
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to check presence of FRU [" +
+                            i_vpdFilePath + "] in collection context, error: " +
+                            std::string(l_ex.what()));
+    }
+    return false;
+}
+
+bool Worker::isInterfaceUnderPim(const std::string& i_inventoryObjPath,
+                                 const std::string& i_interface) const
+{
+    if (const auto l_context = getCollectionContext(); l_context)
+    {
+        const auto l_itrToObj =
+            l_context->m_pimInterfaces.find(i_inventoryObjPath);
+
+        return (l_itrToObj != l_context->m_pimInterfaces.end() &&
+                std::find(l_itrToObj->second.begin(), l_itrToObj->second.end(),
+                          i_interface) != l_itrToObj->second.end());
+    }
+
+    std::array<const char*, 1> l_interfaces = {i_interface.c_str()};
+
+    const auto& l_mapperObjectMap =
+        dbusUtility::getObjectMap(i_inventoryObjPath, l_interfaces);
+
+    return std::any_of(l_mapperObjectMap.begin(), l_mapperObjectMap.end(),
+                       [](const auto& l_serviceInfPair) {
+                           return l_serviceInfPair.first ==
+                                  constants::pimServiceName;
+                       });
+}
+
+void Worker::processFunctionalProperty(const std::string& i_inventoryObjPath,
+                                       types::InterfaceMap& io_interfaces)
+{
+    if (!isChassisPowerOn())
+    {
+        if (isInterfaceUnderPim(i_inventoryObjPath,
+                                constants::operationalStatusInf))
+        {
+            // The object is already under PIM. No need to process
+            // again. Retain the old value.
+            return;
+        }
+
         // Implies value is not there in D-Bus. Populate it with default
         // value "true".
         types::PropertyMap l_functionalProp;
@@ -955,25 +1327,13 @@ void Worker::processFunctionalProperty(const std::string& i_inventoryObjPath,
 void Worker::processEnabledProperty(const std::string& i_inventoryObjPath,
                                     types::InterfaceMap& io_interfaces)
 {
-    if (!dbusUtility::isChassisPowerOn())
+    if (!isChassisPowerOn())
     {
-        std::array<const char*, 1> l_enableInf = {constants::enableInf};
-
-        auto mapperObjectMap =
-            dbusUtility::getObjectMap(i_inventoryObjPath, l_enableInf);
-
-        // If the object has been found. Check if it is under PIM.
-        if (mapperObjectMap.size() != 0)
+        if (isInterfaceUnderPim(i_inventoryObjPath, constants::enableInf))
         {
-            for (const auto& [l_serviceName, l_interfaceLsit] : mapperObjectMap)
-            {
-                if (l_serviceName == constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
-            }
+            // The object is already under PIM. No need to process
+            // again. Retain the old value.
+            return;
         }
 
         // Implies value is not there in D-Bus. Populate it with default
@@ -993,6 +1353,9 @@ void Worker::populateDbus(const types::VPDMapVariant& parsedVpdMap,
                           types::ObjectMap& objectInterfaceMap,
                           const std::string& vpdFilePath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (vpdFilePath.empty())
     {
         throw std::runtime_error(
@@ -1002,11 +1365,11 @@ void Worker::populateDbus(const types::VPDMapVariant& parsedVpdMap,
 
     // JSON config is mandatory for processing of "if". Add "else" for any
     // processing without config JSON.
-    if (!m_parsedJson.empty())
+    if (!l_sysCfgJsonObj->empty())
     {
         types::InterfaceMap interfaces;
 
-        for (const auto& aFru : m_parsedJson["frus"][vpdFilePath])
+        for (const auto& aFru : l_sysCfgJsonObj->at("frus").at(vpdFilePath))
         {
             const auto& inventoryPath = aFru["inventoryPath"];
             sdbusplus::message::object_path fruObjectPath(inventoryPath);
@@ -1115,8 +1478,11 @@ void Worker::publishSystemVPD(const types::VPDMapVariant& parsedVpdMap)
 {
     types::ObjectMap objectInterfaceMap;
 
-    if (std::get_if<types::IPZVpdMap>(&parsedVpdMap))
+    if (auto l_ipzVpdMap = std::get_if<types::IPZVpdMap>(&parsedVpdMap))
     {
+        // Cache keywords needed to expand location code of other FRUs.
+        cacheSystemKeywords(*l_ipzVpdMap);
+
         populateDbus(parsedVpdMap, objectInterfaceMap, SYSTEM_VPD_FILE_PATH);
 
         try
@@ -1164,6 +1530,9 @@ void Worker::publishSystemVPD(const types::VPDMapVariant& parsedVpdMap)
 bool Worker::processPreAction(const std::string& i_vpdFilePath,
                               const std::string& i_flagToProcess)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (i_vpdFilePath.empty() || i_flagToProcess.empty())
     {
         logging::logMessage(
@@ -1171,9 +1540,15 @@ bool Worker::processPreAction(const std::string& i_vpdFilePath,
         return false;
     }
 
-    if ((!jsonUtility::executeBaseAction(m_parsedJson, "preAction",
-                                         i_vpdFilePath, i_flagToProcess)) &&
-        (i_flagToProcess.compare("collection") == constants::STR_CMP_SUCCESS))
+    const bool l_isCollection =
+        (i_flagToProcess.compare("collection") == constants::STR_CMP_SUCCESS);
+
+    // A FRU already sampled as absent need not go through the pre-action.
+    if ((l_isCollection && isFruAbsentInCollectionContext(i_vpdFilePath)) ||
+        ((!jsonUtility::executeBaseAction(*l_sysCfgJsonObj, "preAction",
+                                          i_vpdFilePath, i_flagToProcess,
+                                          m_gpioService)) &&
+         l_isCollection))
     {
         // TODO: Need a way to delete inventory object from Dbus and persisted
         // data section in case any FRU is not present or there is any
@@ -1189,8 +1564,8 @@ bool Worker::processPreAction(const std::string& i_vpdFilePath,
         // removed this can lead to ambiguity. Hence clearing this
         // Keyword if FRU is absent.
         const auto& inventoryPath =
-            m_parsedJson["frus"][i_vpdFilePath].at(0).value("inventoryPath",
-                                                            "");
+            l_sysCfgJsonObj->at("frus").at(i_vpdFilePath).at(0).value(
+                "inventoryPath", "");
 
         if (!inventoryPath.empty())
         {
@@ -1220,6 +1595,9 @@ bool Worker::processPostAction(
     const std::string& i_vpdFruPath, const std::string& i_flagToProcess,
     const std::optional<types::VPDMapVariant> i_parsedVpd)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (i_vpdFruPath.empty() || i_flagToProcess.empty())
     {
         logging::logMessage(
@@ -1227,11 +1605,14 @@ bool Worker::processPostAction(
         return false;
     }
 
+    const nlohmann::json& l_fruJson =
+        l_sysCfgJsonObj->at("frus").at(i_vpdFruPath).at(0);
+
     // Check if post action tag is to be triggered in the flow of collection
-    // based on some CCIN value?
-    if (m_parsedJson["frus"][i_vpdFruPath]
-            .at(0)["postAction"][i_flagToProcess]
-            .contains("ccin"))
+    // based on some CCIN value? JSON is const, tags are looked up without
+    // operator[] as they may be missing.
+    if (l_fruJson.contains(nlohmann::json::json_pointer(
+            "/postAction/" + i_flagToProcess + "/ccin")))
     {
         if (!i_parsedVpd.has_value())
         {
@@ -1242,8 +1623,7 @@ bool Worker::processPostAction(
         // CCIN match is required to process post action for this FRU as it
         // contains the flag.
         if (!vpdSpecificUtility::findCcinInVpd(
-                m_parsedJson["frus"][i_vpdFruPath].at(
-                    0)["postAction"]["collection"],
+                l_fruJson.at("postAction").at(i_flagToProcess),
                 i_parsedVpd.value()))
         {
             // If CCIN is not found, implies post action processing is not
@@ -1252,8 +1632,9 @@ bool Worker::processPostAction(
         }
     }
 
-    if (!jsonUtility::executeBaseAction(m_parsedJson, "postAction",
-                                        i_vpdFruPath, i_flagToProcess))
+    if (!jsonUtility::executeBaseAction(*l_sysCfgJsonObj, "postAction",
+                                        i_vpdFruPath, i_flagToProcess,
+                                        m_gpioService))
     {
         logging::logMessage(
             "Execution of post action failed for path: " + i_vpdFruPath);
@@ -1268,6 +1649,9 @@ bool Worker::processPostAction(
 
 types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         if (i_vpdFilePath.empty())
@@ -1278,7 +1662,7 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
         }
 
         bool isPreActionRequired = false;
-        if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
+        if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, i_vpdFilePath,
                                           "preAction", "collection"))
         {
             isPreActionRequired = true;
@@ -1289,6 +1673,20 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
             }
         }
 
+        // EEPROM may show up only once its driver has probed it after the
+        // pre-action, wait for it instead of failing right away. The wait
+        // blocks the calling thread for up to the timeout, woken up by
+        // uevents rather than polling. Only threads of the bulk pass wait, as
+        // each FRU has a thread of its own there, the wait holds up no other
+        // FRU. Others run on the event loop or on the I/O pool which can't be
+        // blocked, and the EEPROM is checked once for them.
+        if (isPreActionRequired && s_isBulkCollectionThread)
+        {
+            m_eepromWatcher.waitForEeprom(
+                i_vpdFilePath, std::chrono::milliseconds(
+                                   constants::EEPROM_APPEARANCE_TIMEOUT_MS));
+        }
+
         if (!std::filesystem::exists(i_vpdFilePath))
         {
             if (isPreActionRequired)
@@ -1301,7 +1699,7 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
         }
 
         std::shared_ptr<Parser> vpdParser =
-            std::make_shared<Parser>(i_vpdFilePath, m_parsedJson);
+            std::make_shared<Parser>(i_vpdFilePath, l_sysCfgJsonObj);
 
         types::VPDMapVariant l_parsedVpd = vpdParser->parse();
 
@@ -1309,14 +1707,14 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
         // any post action in the flow of collection.
         // Note: Don't change the order, post action needs to be processed only
         // after collection for FRU is successfully done.
-        if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
+        if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, i_vpdFilePath,
                                           "postAction", "collection"))
         {
             if (!processPostAction(i_vpdFilePath, "collection", l_parsedVpd))
             {
                 // Post action was required but failed while executing.
                 // Behaviour can be undefined.
-                EventLogger::createSyncPel(
+                EventLogger::createQueuedPel(
                     types::ErrorType::InternalFailure,
                     types::SeverityType::Warning, __FILE__, __FUNCTION__, 0,
                     std::string("Required post action failed for path [" +
@@ -1325,16 +1723,23 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
             }
         }
 
+        // Cache is filled by reads only, drop what was read before this
+        // collection.
+        invalidateParsedVpd(i_vpdFilePath);
+
         return l_parsedVpd;
     }
     catch (std::exception& l_ex)
     {
+        invalidateParsedVpd(i_vpdFilePath);
+
         // If post fail action is required, execute it.
-        if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
+        if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, i_vpdFilePath,
                                           "postFailAction", "collection"))
         {
-            if (!jsonUtility::executePostFailAction(m_parsedJson, i_vpdFilePath,
-                                                    "collection"))
+            if (!jsonUtility::executePostFailAction(
+                    *l_sysCfgJsonObj, i_vpdFilePath, "collection",
+                    m_gpioService))
             {
                 throw std::runtime_error(
                     std::string(__FUNCTION__) + "VPD parsing failed for " +
@@ -1349,9 +1754,58 @@ types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
     }
 }
 
+void Worker::notifyPimAsync(const std::string& i_vpdFilePath,
+                            types::ObjectMap&& i_objectMap)
+{
+    m_pimNotifySemaphore.acquire();
+    m_pendingPimNotifyCount++;
+
+    dbusUtility::callPIMAsync(
+        m_asioConnection, std::move(i_objectMap),
+        [this, i_vpdFilePath](bool i_isSuccess) {
+            try
+            {
+                if (!i_isSuccess)
+                {
+                    setCollectionStatusProperty(
+                        i_vpdFilePath, constants::vpdCollectionFailure);
+
+                    EventLogger::createAsyncPel(
+                        types::ErrorType::DbusFailure,
+                        types::SeverityType::Informational, __FILE__,
+                        __FUNCTION__, 0,
+                        "Call to PIM failed while publishing VPD for " +
+                            i_vpdFilePath,
+                        std::nullopt, std::nullopt, std::nullopt,
+                        std::nullopt);
+
+                    const std::shared_ptr<const nlohmann::json>
+                        l_sysCfgJsonObj = getSysCfgJsonObj();
+
+                    if (isPresentPropertyHandlingRequired(
+                            l_sysCfgJsonObj->at("frus").at(i_vpdFilePath).at(
+                                0)))
+                    {
+                        setPresentProperty(i_vpdFilePath, false);
+                    }
+                }
+            }
+            catch (const std::exception& l_ex)
+            {
+                logging::logMessage(l_ex.what());
+            }
+
+            m_pendingPimNotifyCount--;
+            m_pimNotifySemaphore.release();
+        });
+}
+
 std::tuple<bool, std::string> Worker::parseAndPublishVPD(
     const std::string& i_vpdFilePath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     std::string l_inventoryPath{};
 
     try
@@ -1366,12 +1820,13 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
         // Set CollectionStatus as InProgress. Since it's an intermediate state
         // D-bus set-property call is good enough to update the status.
         l_inventoryPath = jsonUtility::getInventoryObjPathFromJson(
-            m_parsedJson, i_vpdFilePath);
+            *l_sysCfgJsonObj, i_vpdFilePath);
 
         if (!l_inventoryPath.empty())
         {
             if (!dbusUtility::writeDbusProperty(
-                    jsonUtility::getServiceName(m_parsedJson, l_inventoryPath),
+                    jsonUtility::getServiceName(*l_sysCfgJsonObj,
+                                                l_inventoryPath),
                     l_inventoryPath, constants::vpdCollectionInterface,
                     "CollectionStatus",
                     types::DbusVariantType{constants::vpdCollectionInProgress}))
@@ -1389,7 +1844,11 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
             populateDbus(parsedVpdMap, objectInterfaceMap, i_vpdFilePath);
 
             // Notify PIM
-            if (!dbusUtility::callPIM(move(objectInterfaceMap)))
+            if (m_asioConnection)
+            {
+                notifyPimAsync(i_vpdFilePath, std::move(objectInterfaceMap));
+            }
+            else if (!dbusUtility::callPIM(move(objectInterfaceMap)))
             {
                 throw std::runtime_error(
                     std::string(__FUNCTION__) +
@@ -1417,8 +1876,8 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
             {
                 const std::string& l_invPathLeafValue =
                     sdbusplus::message::object_path(
-                        jsonUtility::getInventoryObjPathFromJson(m_parsedJson,
-                                                                 i_vpdFilePath))
+                        jsonUtility::getInventoryObjPathFromJson(
+                            *l_sysCfgJsonObj, i_vpdFilePath))
                         .filename();
 
                 if ((l_invPathLeafValue.find("pcie_card", 0) !=
@@ -1430,7 +1889,7 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
             }
         }
 
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             EventLogger::getErrorType(ex), types::SeverityType::Informational,
             __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(ex),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
@@ -1443,7 +1902,7 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
         // Update Present property for this FRU only if we handle Present
         // property for the FRU.
         if (isPresentPropertyHandlingRequired(
-                m_parsedJson["frus"][i_vpdFilePath].at(0)))
+                l_sysCfgJsonObj->at("frus").at(i_vpdFilePath).at(0)))
         {
             setPresentProperty(i_vpdFilePath, false);
         }
@@ -1457,6 +1916,9 @@ std::tuple<bool, std::string> Worker::parseAndPublishVPD(
 
 bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (i_vpdFilePath.empty())
     {
         return true;
@@ -1468,18 +1930,18 @@ bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
         return true;
     }
 
-    if (dbusUtility::isChassisPowerOn())
+    if (isChassisPowerOn())
     {
         // If chassis is powered on, skip collecting FRUs which are
         // powerOffOnly.
-        if (jsonUtility::isFruPowerOffOnly(m_parsedJson, i_vpdFilePath))
+        if (jsonUtility::isFruPowerOffOnly(*l_sysCfgJsonObj, i_vpdFilePath))
         {
             return true;
         }
 
         const std::string& l_invPathLeafValue =
             sdbusplus::message::object_path(
-                jsonUtility::getInventoryObjPathFromJson(m_parsedJson,
+                jsonUtility::getInventoryObjPathFromJson(*l_sysCfgJsonObj,
                                                          i_vpdFilePath))
                 .filename();
 
@@ -1494,8 +1956,11 @@ bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
 
 void Worker::collectFrusFromJson()
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     // A parsed JSON file should be present to pick FRUs EEPROM paths
-    if (m_parsedJson.empty())
+    if (l_sysCfgJsonObj->empty())
     {
         throw JsonException(
             std::string(__FUNCTION__) +
@@ -1504,7 +1969,23 @@ void Worker::collectFrusFromJson()
     }
 
     const nlohmann::json& listOfFrus =
-        m_parsedJson["frus"].get_ref<const nlohmann::json::object_t&>();
+        l_sysCfgJsonObj->at("frus").get_ref<const nlohmann::json::object_t&>();
+
+    // Snapshot D-Bus state once for the whole lot instead of querying it for
+    // every FRU. Each collection thread holds the pass guard, the snapshot is
+    // dropped once the last of them is done, or right away if none is spawned.
+    createCollectionContext();
+
+    std::shared_ptr<void> l_passGuard(
+        nullptr, [this, l_context = getCollectionContext()](auto) {
+            std::lock_guard<std::mutex> l_lock(m_collectionContextMutex);
+
+            // Leave alone a snapshot taken by someone else meanwhile.
+            if (m_collectionContext == l_context)
+            {
+                m_collectionContext.reset();
+            }
+        });
 
     for (const auto& itemFRUS : listOfFrus.items())
     {
@@ -1517,7 +1998,8 @@ void Worker::collectFrusFromJson()
 
         try
         {
-            std::thread{[vpdFilePath, this]() {
+            std::thread{[vpdFilePath, this, l_passGuard]() {
+                s_isBulkCollectionThread = true;
                 const auto& l_parseResult = parseAndPublishVPD(vpdFilePath);
 
                 m_mutex.lock();
@@ -1541,10 +2023,13 @@ void Worker::collectFrusFromJson()
 // ToDo: Move the API under IBM_SYSTEM
 void Worker::performBackupAndRestore(types::VPDMapVariant& io_srcVpdMap)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         std::string l_backupAndRestoreCfgFilePath =
-            m_parsedJson.value("backupRestoreConfigPath", "");
+            l_sysCfgJsonObj->value("backupRestoreConfigPath", "");
 
         nlohmann::json l_backupAndRestoreCfgJsonObj =
             jsonUtility::getParsedJson(l_backupAndRestoreCfgFilePath);
@@ -1566,7 +2051,8 @@ void Worker::performBackupAndRestore(types::VPDMapVariant& io_srcVpdMap)
               l_backupAndRestoreCfgJsonObj["destination"].contains(
                   "inventoryPath"))))
         {
-            BackupAndRestore l_backupAndRestoreObj(m_parsedJson);
+            BackupAndRestore l_backupAndRestoreObj(*l_sysCfgJsonObj,
+                                                   m_eepromWriteQueue);
             auto [l_srcVpdVariant,
                   l_dstVpdVariant] = l_backupAndRestoreObj.backupAndRestore();
 
@@ -1593,13 +2079,16 @@ void Worker::performBackupAndRestore(types::VPDMapVariant& io_srcVpdMap)
 
 void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     if (i_dbusObjPath.empty())
     {
         throw std::runtime_error("Given DBus object path is empty.");
     }
 
     const std::string& l_fruPath =
-        jsonUtility::getFruPathFromJson(m_parsedJson, i_dbusObjPath);
+        jsonUtility::getFruPathFromJson(*l_sysCfgJsonObj, i_dbusObjPath);
 
     try
     {
@@ -1615,7 +2104,7 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
             }
             else
             {
-                if (jsonUtility::isActionRequired(m_parsedJson, l_fruPath,
+                if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, l_fruPath,
                                                   "preAction", "deletion"))
                 {
                     if (!processPreAction(l_fruPath, "deletion"))
@@ -1624,6 +2113,8 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
                     }
                 }
 
+                // Only the FRU's own subtree is looked up, PIM data of the
+                // rest of the inventory is of no use here.
                 std::vector<std::string> l_interfaceList{
                     constants::operationalStatusInf};
 
@@ -1656,7 +2147,9 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
                     throw std::runtime_error("Call to PIM failed.");
                 }
 
-                if (jsonUtility::isActionRequired(m_parsedJson, l_fruPath,
+                invalidateParsedVpd(l_fruPath);
+
+                if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, l_fruPath,
                                                   "postAction", "deletion"))
                 {
                     if (!processPostAction(l_fruPath, "deletion"))
@@ -1679,11 +2172,11 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
     }
     catch (const std::exception& l_ex)
     {
-        if (jsonUtility::isActionRequired(m_parsedJson, l_fruPath,
+        if (jsonUtility::isActionRequired(*l_sysCfgJsonObj, l_fruPath,
                                           "postFailAction", "deletion"))
         {
-            if (!jsonUtility::executePostFailAction(m_parsedJson, l_fruPath,
-                                                    "deletion"))
+            if (!jsonUtility::executePostFailAction(
+                    *l_sysCfgJsonObj, l_fruPath, "deletion", m_gpioService))
             {
                 logging::logMessage(
                     "Post fail action failed for: " + i_dbusObjPath);
@@ -1698,6 +2191,9 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
 void Worker::setPresentProperty(const std::string& i_vpdPath,
                                 const bool& i_value)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         if (i_vpdPath.empty())
@@ -1709,9 +2205,9 @@ void Worker::setPresentProperty(const std::string& i_vpdPath,
         types::ObjectMap l_objectInterfaceMap;
 
         // If the given path is EEPROM path.
-        if (m_parsedJson["frus"].contains(i_vpdPath))
+        if (l_sysCfgJsonObj->at("frus").contains(i_vpdPath))
         {
-            for (const auto& l_Fru : m_parsedJson["frus"][i_vpdPath])
+            for (const auto& l_Fru : l_sysCfgJsonObj->at("frus").at(i_vpdPath))
             {
                 sdbusplus::message::object_path l_fruObjectPath(
                     l_Fru["inventoryPath"]);
@@ -1759,7 +2255,7 @@ void Worker::setPresentProperty(const std::string& i_vpdPath,
     }
     catch (const std::exception& l_ex)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             EventLogger::getErrorType(l_ex), types::SeverityType::Warning,
             __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(l_ex),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
@@ -1768,17 +2264,20 @@ void Worker::setPresentProperty(const std::string& i_vpdPath,
 
 void Worker::performVpdRecollection()
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         // Check if system config JSON is present
-        if (m_parsedJson.empty())
+        if (l_sysCfgJsonObj->empty())
         {
             throw std::runtime_error(
                 "System config json object is empty, can't process recollection.");
         }
 
         const auto& l_frusReplaceableAtStandby =
-            jsonUtility::getListOfFrusReplaceableAtStandby(m_parsedJson);
+            jsonUtility::getListOfFrusReplaceableAtStandby(*l_sysCfgJsonObj);
 
         for (const auto& l_fruInventoryPath : l_frusReplaceableAtStandby)
         {
@@ -1801,10 +2300,13 @@ void Worker::performVpdRecollection()
 void Worker::collectSingleFruVpd(
     const sdbusplus::message::object_path& i_dbusObjPath)
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         // Check if system config JSON is present
-        if (m_parsedJson.empty())
+        if (l_sysCfgJsonObj->empty())
         {
             logging::logMessage(
                 "System config JSON object not present. Single FRU VPD collection is not performed for " +
@@ -1814,7 +2316,7 @@ void Worker::collectSingleFruVpd(
 
         // Get FRU path for the given D-bus object path from JSON
         const std::string& l_fruPath =
-            jsonUtility::getFruPathFromJson(m_parsedJson, i_dbusObjPath);
+            jsonUtility::getFruPathFromJson(*l_sysCfgJsonObj, i_dbusObjPath);
 
         if (l_fruPath.empty())
         {
@@ -1825,9 +2327,9 @@ void Worker::collectSingleFruVpd(
         }
 
         // Check if host is up and running
-        if (dbusUtility::isHostRunning())
+        if (m_systemStateCache->isHostRunning())
         {
-            if (!jsonUtility::isFruReplaceableAtRuntime(m_parsedJson,
+            if (!jsonUtility::isFruReplaceableAtRuntime(*l_sysCfgJsonObj,
                                                         l_fruPath))
             {
                 logging::logMessage(
@@ -1836,11 +2338,11 @@ void Worker::collectSingleFruVpd(
                 return;
             }
         }
-        else if (dbusUtility::isBMCReady())
+        else if (m_systemStateCache->isBMCReady())
         {
-            if (!jsonUtility::isFruReplaceableAtStandby(m_parsedJson,
+            if (!jsonUtility::isFruReplaceableAtStandby(*l_sysCfgJsonObj,
                                                         l_fruPath) &&
-                (!jsonUtility::isFruReplaceableAtRuntime(m_parsedJson,
+                (!jsonUtility::isFruReplaceableAtRuntime(*l_sysCfgJsonObj,
                                                          l_fruPath)))
             {
                 logging::logMessage(
@@ -1855,7 +2357,7 @@ void Worker::collectSingleFruVpd(
         const std::string& l_collStatusProp = "CollectionStatus";
 
         if (!dbusUtility::writeDbusProperty(
-                jsonUtility::getServiceName(m_parsedJson,
+                jsonUtility::getServiceName(*l_sysCfgJsonObj,
                                             std::string(i_dbusObjPath)),
                 std::string(i_dbusObjPath), constants::vpdCollectionInterface,
                 l_collStatusProp,
@@ -1915,6 +2417,9 @@ void Worker::collectSingleFruVpd(
 void Worker::setCollectionStatusProperty(
     const std::string& i_vpdPath, const std::string& i_value) const noexcept
 {
+    const std::shared_ptr<const nlohmann::json> l_sysCfgJsonObj =
+        getSysCfgJsonObj();
+
     try
     {
         if (i_vpdPath.empty())
@@ -1925,9 +2430,9 @@ void Worker::setCollectionStatusProperty(
 
         types::ObjectMap l_objectInterfaceMap;
 
-        if (m_parsedJson["frus"].contains(i_vpdPath))
+        if (l_sysCfgJsonObj->at("frus").contains(i_vpdPath))
         {
-            for (const auto& l_Fru : m_parsedJson["frus"][i_vpdPath])
+            for (const auto& l_Fru : l_sysCfgJsonObj->at("frus").at(i_vpdPath))
             {
                 sdbusplus::message::object_path l_fruObjectPath(
                     l_Fru["inventoryPath"]);
@@ -1976,7 +2481,7 @@ void Worker::setCollectionStatusProperty(
     }
     catch (const std::exception& l_ex)
     {
-        EventLogger::createSyncPel(
+        EventLogger::createQueuedPel(
             EventLogger::getErrorType(l_ex), types::SeverityType::Warning,
             __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(l_ex),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);